@@ -38,6 +38,7 @@ public class EasyEIBindings : ModuleRules
 			{
 				"CoreUObject",
 				"Engine",
+				"InputCore",
 				"Slate",
 				"SlateCore",
 				// ... add private dependencies that you statically link with here ...	
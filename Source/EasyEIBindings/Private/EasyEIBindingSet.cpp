@@ -0,0 +1,51 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+
+#include "EasyEIBindingSet.h"
+
+#include "EasyEIBindings.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+
+
+TSharedPtr<FStreamableHandle> UEasyEIBindingSet::RequestPreload()
+{
+	if (TSharedPtr<FStreamableHandle> Handle = PreloadHandle.Pin())
+	{
+		return Handle;
+	}
+
+	TArray<FSoftObjectPath> Paths;
+	for (const FEasyEIBinding& Binding : Bindings)
+	{
+		if (!Binding.InputAction && !Binding.SoftInputAction.IsNull())
+		{
+			Paths.AddUnique(Binding.SoftInputAction.ToSoftObjectPath());
+		}
+	}
+
+	if (Paths.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	TSharedPtr<FStreamableHandle> Handle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+		MoveTemp(Paths), FStreamableDelegate::CreateUObject(this, &UEasyEIBindingSet::HandlePreloadComplete));
+	PreloadHandle = Handle;
+	return Handle;
+}
+
+void UEasyEIBindingSet::HandlePreloadComplete()
+{
+	PreloadCompleteDelegate.Broadcast();
+}
+
+#if WITH_EDITOR
+void UEasyEIBindingSet::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+	Super::PostEditChangeProperty(PropertyChangedEvent);
+
+	// Resolved tables are keyed by the asset, drop them so the next setup sees the edit
+	FEasyEIBindingsModule::Get().GetBindingCache().Invalidate();
+}
+#endif
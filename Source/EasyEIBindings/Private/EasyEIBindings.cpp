@@ -2,19 +2,59 @@
 
 #include "EasyEIBindings.h"
 
+#include "EasyEIInputTimestamper.h"
+#include "Framework/Application/SlateApplication.h"
+#include "UObject/UObjectGlobals.h"
+
 DEFINE_LOG_CATEGORY(LogEasyEIBindings);
 
+UE_TRACE_CHANNEL_DEFINE(EasyEIBindingsChannel);
+
 #define LOCTEXT_NAMESPACE "FEasyEIBindingsModule"
 
 void FEasyEIBindingsModule::StartupModule()
 {
 	// This code will execute after your module is loaded into memory; the exact timing is specified in the .uplugin file per-module
+	ReloadCompleteHandle = FCoreUObjectDelegates::ReloadCompleteDelegate.AddRaw(
+		this, &FEasyEIBindingsModule::HandleReloadComplete);
+	PostGarbageCollectHandle = FCoreUObjectDelegates::GetPostGarbageCollect().AddRaw(
+		this, &FEasyEIBindingsModule::HandlePostGarbageCollect);
 }
 
 void FEasyEIBindingsModule::ShutdownModule()
 {
 	// This function may be called during shutdown to clean up your module.  For modules that support dynamic reloading,
 	// we call this function before unloading the module.
+	FCoreUObjectDelegates::ReloadCompleteDelegate.Remove(ReloadCompleteHandle);
+	FCoreUObjectDelegates::GetPostGarbageCollect().Remove(PostGarbageCollectHandle);
+	BindingCache.Invalidate();
+
+	if (InputTimestamper.IsValid() && FSlateApplication::IsInitialized())
+	{
+		FSlateApplication::Get().UnregisterInputPreProcessor(InputTimestamper);
+	}
+	InputTimestamper.Reset();
+}
+
+const FEasyEIInputTimestamper* FEasyEIBindingsModule::GetInputTimestamper()
+{
+	if (!InputTimestamper.IsValid() && FSlateApplication::IsInitialized())
+	{
+		InputTimestamper = MakeShared<FEasyEIInputTimestamper>();
+		FSlateApplication::Get().RegisterInputPreProcessor(InputTimestamper);
+	}
+	return InputTimestamper.Get();
+}
+
+void FEasyEIBindingsModule::HandleReloadComplete(EReloadCompleteReason Reason)
+{
+	// Hot reload and live coding replace classes and their functions
+	BindingCache.Invalidate();
+}
+
+void FEasyEIBindingsModule::HandlePostGarbageCollect()
+{
+	BindingCache.PurgeStaleEntries();
 }
 
 #undef LOCTEXT_NAMESPACE
@@ -0,0 +1,193 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+
+#include "EasyEIBindingsCache.h"
+
+#include "EasyEIBindingSet.h"
+#include "InputAction.h"
+
+
+namespace EasyEIBindings
+{
+	struct FEventSpec
+	{
+		const TCHAR* Suffix;
+		ETriggerEvent Event;
+	};
+
+	static const FEventSpec EventSpecs[NumTriggerEvents] = {
+		{TEXT("Triggered"), ETriggerEvent::Triggered},
+		{TEXT("Started"), ETriggerEvent::Started},
+		{TEXT("Ongoing"), ETriggerEvent::Ongoing},
+		{TEXT("Completed"), ETriggerEvent::Completed},
+		{TEXT("Canceled"), ETriggerEvent::Canceled}
+	};
+
+	ETriggerEvent GetTriggerEvent(int32 EventIndex)
+	{
+		check(EventIndex >= 0 && EventIndex < NumTriggerEvents);
+		return EventSpecs[EventIndex].Event;
+	}
+
+	int32 GetTriggerEventIndex(ETriggerEvent Event)
+	{
+		for (int32 EventIndex = 0; EventIndex < NumTriggerEvents; ++EventIndex)
+		{
+			if (EventSpecs[EventIndex].Event == Event)
+			{
+				return EventIndex;
+			}
+		}
+		return INDEX_NONE;
+	}
+
+	const TCHAR* GetTriggerEventSuffix(int32 EventIndex)
+	{
+		check(EventIndex >= 0 && EventIndex < NumTriggerEvents);
+		return EventSpecs[EventIndex].Suffix;
+	}
+
+	FName MakeHandlerName(const UInputAction* Action, int32 EventIndex)
+	{
+		if (!Action)
+		{
+			return NAME_None;
+		}
+
+		return MakeHandlerName(Action->GetName(), EventIndex);
+	}
+
+	FName MakeHandlerName(FString ActionName, int32 EventIndex)
+	{
+		ActionName.RemoveFromStart(TEXT("IA_"));
+		return FName(*FString::Printf(TEXT("IA_%s_%s"), *ActionName, GetTriggerEventSuffix(EventIndex)));
+	}
+}
+
+const FEasyEIResolvedAction& FEasyEIBindingsCache::FindOrResolve(const UClass* OwnerClass, const UInputAction* Action)
+{
+	check(IsInGameThread());
+
+	const FKey Key(FObjectKey(OwnerClass), FObjectKey(Action));
+	if (const FEasyEIResolvedAction* Found = Entries.Find(Key))
+	{
+		return *Found;
+	}
+
+	return Entries.Add(Key, Resolve(OwnerClass, Action));
+}
+
+const FEasyEIResolvedAction& FEasyEIBindingsCache::FindOrSeed(const UClass* OwnerClass, const UInputAction* Action,
+                                                             const FName (&BakedHandlerNames)[EasyEIBindings::NumTriggerEvents])
+{
+	check(IsInGameThread());
+
+	const FKey Key(FObjectKey(OwnerClass), FObjectKey(Action));
+	if (const FEasyEIResolvedAction* Found = Entries.Find(Key))
+	{
+		return *Found;
+	}
+
+	FEasyEIResolvedAction Resolved;
+	if (OwnerClass && Action)
+	{
+		for (int32 EventIndex = 0; EventIndex < EasyEIBindings::NumTriggerEvents; ++EventIndex)
+		{
+			// The owner class may have changed without a resave, so baked names are still looked up once
+			Resolved.HandlerNames[EventIndex] = BakedHandlerNames[EventIndex].IsNone()
+				                                    ? EasyEIBindings::MakeHandlerName(Action, EventIndex)
+				                                    : BakedHandlerNames[EventIndex];
+			Resolved.Handlers[EventIndex] = OwnerClass->FindFunctionByName(Resolved.HandlerNames[EventIndex]);
+		}
+	}
+	return Entries.Add(Key, Resolved);
+}
+
+FEasyEIResolvedAction FEasyEIBindingsCache::Resolve(const UClass* OwnerClass, const UInputAction* Action)
+{
+	FEasyEIResolvedAction Resolved;
+	if (!OwnerClass || !Action)
+	{
+		return Resolved;
+	}
+
+	for (int32 EventIndex = 0; EventIndex < EasyEIBindings::NumTriggerEvents; ++EventIndex)
+	{
+		Resolved.HandlerNames[EventIndex] = EasyEIBindings::MakeHandlerName(Action, EventIndex);
+		Resolved.Handlers[EventIndex] = OwnerClass->FindFunctionByName(Resolved.HandlerNames[EventIndex]);
+	}
+	return Resolved;
+}
+
+const FEasyEIResolvedBindingSet& FEasyEIBindingsCache::FindOrResolveSet(const UClass* OwnerClass,
+                                                                         const UEasyEIBindingSet* BindingSet)
+{
+	check(IsInGameThread());
+
+	const FKey Key(FObjectKey(OwnerClass), FObjectKey(BindingSet));
+	if (const FEasyEIResolvedBindingSet* Found = SetEntries.Find(Key))
+	{
+		return *Found;
+	}
+
+	FEasyEIResolvedBindingSet ResolvedSet;
+	bool bComplete = true;
+	if (OwnerClass && BindingSet)
+	{
+		ResolvedSet.Bindings.Reserve(BindingSet->Bindings.Num());
+		for (int32 BindingIndex = 0; BindingIndex < BindingSet->Bindings.Num(); ++BindingIndex)
+		{
+			const FEasyEIBinding& Binding = BindingSet->Bindings[BindingIndex];
+			const UInputAction* Action = Binding.GetInputAction();
+			if (!Action)
+			{
+				if (Binding.NeedsLoad())
+				{
+					// Resolved before the set finished loading, do not keep an incomplete table
+					bComplete = false;
+				}
+				continue;
+			}
+
+			FEasyEIResolvedSetBinding& Entry = ResolvedSet.Bindings.AddDefaulted_GetRef();
+			Entry.Action = Action;
+			Entry.BindingIndex = BindingIndex;
+			Entry.EnabledEventSlots = Binding.GetEnabledEventSlots();
+			Entry.Resolved = FindOrResolve(OwnerClass, Action);
+		}
+	}
+
+	if (!bComplete)
+	{
+		IncompleteSet = MoveTemp(ResolvedSet);
+		return IncompleteSet;
+	}
+
+	return SetEntries.Add(Key, MoveTemp(ResolvedSet));
+}
+
+void FEasyEIBindingsCache::Invalidate()
+{
+	Entries.Reset();
+	SetEntries.Reset();
+	++Generation;
+}
+
+void FEasyEIBindingsCache::PurgeStaleEntries()
+{
+	for (auto It = Entries.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().Key.ResolveObjectPtr() || !It.Key().Value.ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	for (auto It = SetEntries.CreateIterator(); It; ++It)
+	{
+		if (!It.Key().Key.ResolveObjectPtr() || !It.Key().Value.ResolveObjectPtr())
+		{
+			It.RemoveCurrent();
+		}
+	}
+}
@@ -4,17 +4,212 @@
 #include "EasyEIBindingsComponent.h"
 
 #include "EasyEIBindings.h"
+#include "EasyEIBindingSet.h"
+#include "EasyEIBindingsCache.h"
+#include "EasyEIBindingsRecording.h"
+#include "EasyEIBindingsRuntimeSettings.h"
+#include "EasyEIBindingsSetupSubsystem.h"
+#include "EasyEIBindingsTags.h"
+#include "EasyEIInputTimestamper.h"
 #include "EnhancedInputComponent.h"
+#include "EnhancedInputSubsystems.h"
+#include "EnhancedPlayerInput.h"
+#include "Engine/AssetManager.h"
+#include "Engine/LocalPlayer.h"
+#include "Engine/StreamableManager.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "HAL/FileManager.h"
+#include "Misc/EngineVersionComparison.h"
+#include "Misc/Paths.h"
+#include "GameFramework/Pawn.h"
 #include "GameFramework/PlayerController.h"
+#include "EngineUtils.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "TimerManager.h"
+#include "UObject/ObjectSaveContext.h"
+
+DECLARE_CYCLE_STAT(TEXT("SetupInputActions"), STAT_EasyEIBindings_SetupInputActions, STATGROUP_EasyEIBindings);
+DECLARE_CYCLE_STAT(TEXT("RebindInputActions"), STAT_EasyEIBindings_RebindInputActions, STATGROUP_EasyEIBindings);
+DECLARE_CYCLE_STAT(TEXT("ClearInputBindings"), STAT_EasyEIBindings_ClearInputBindings, STATGROUP_EasyEIBindings);
+DECLARE_CYCLE_STAT(TEXT("Dispatch Handler"), STAT_EasyEIBindings_DispatchHandler, STATGROUP_EasyEIBindings);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Dispatched Events"), STAT_EasyEIBindings_DispatchedEvents, STATGROUP_EasyEIBindings);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Coalesced Events"), STAT_EasyEIBindings_CoalescedEvents, STATGROUP_EasyEIBindings);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Suppressed Deliveries"), STAT_EasyEIBindings_SuppressedDeliveries, STATGROUP_EasyEIBindings);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Throttled Events"), STAT_EasyEIBindings_ThrottledEvents, STATGROUP_EasyEIBindings);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Forwarded Bits Sent"), STAT_EasyEIBindings_ForwardedBitsSent, STATGROUP_EasyEIBindings);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Forwarded Bits Received"), STAT_EasyEIBindings_ForwardedBitsReceived, STATGROUP_EasyEIBindings);
+
+static TAutoConsoleVariable<bool> CVarTraceHandlers(
+	TEXT("EasyEIBindings.TraceHandlers"),
+	false,
+	TEXT("Route reflected handlers through component dispatch so each call gets its own EasyEIBindings trace scope.\n")
+	TEXT("Applies to components set up or rebound after the change."));
+
+static FAutoConsoleCommandWithWorld CmdDumpLatency(
+	TEXT("EasyEIBindings.DumpLatency"),
+	TEXT("Logs input-to-handler latency percentiles for components with bMeasureInputLatency set."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		for (TObjectIterator<UEasyEIBindingsComponent> It; It; ++It)
+		{
+			if (It->GetWorld() == World && It->bMeasureInputLatency)
+			{
+				It->DumpInputLatency(*GLog);
+			}
+		}
+	}));
+
+static FAutoConsoleCommandWithWorld CmdDumpForwarding(
+	TEXT("EasyEIBindings.DumpForwarding"),
+	TEXT("Logs packets, events and bytes forwarded to or received by the server for components with bForwardToServer set."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		for (TObjectIterator<UEasyEIBindingsComponent> It; It; ++It)
+		{
+			if (It->GetWorld() == World && It->bForwardToServer)
+			{
+				It->DumpForwardingStats(*GLog);
+			}
+		}
+	}));
+
+/** Recording file of one component, Saved/EasyEIBindings/Recordings/<Name>_<Owner>.eeirec. */
+static FString GetRecordingFilename(const FString& Name, const UEasyEIBindingsComponent* Component)
+{
+	return FPaths::ProjectSavedDir() / TEXT("EasyEIBindings") / TEXT("Recordings")
+		/ FString::Printf(TEXT("%s_%s.eeirec"), *Name, *GetNameSafe(Component->GetOwner()));
+}
+
+static FAutoConsoleCommandWithWorldAndArgs CmdRecord(
+	TEXT("EasyEIBindings.Record"),
+	TEXT("Records the dispatched input of every component in the world to Saved/EasyEIBindings/Recordings/<Name>_<Owner>.eeirec.\n")
+	TEXT("Run without a name to stop recording."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		for (TObjectIterator<UEasyEIBindingsComponent> It; It; ++It)
+		{
+			if (It->GetWorld() != World)
+			{
+				continue;
+			}
+
+			if (Args.IsEmpty())
+			{
+				It->StopInputRecording();
+			}
+			else
+			{
+				It->StartInputRecording(GetRecordingFilename(Args[0], *It));
+			}
+		}
+	}));
+
+static FAutoConsoleCommandWithWorldAndArgs CmdReplay(
+	TEXT("EasyEIBindings.Replay"),
+	TEXT("Replays Saved/EasyEIBindings/Recordings/<Name>_<Owner>.eeirec into every component in the world that has one.\n")
+	TEXT("Run without a name to stop replaying. -EasyEIBindingsReplay=<Name> starts a replay at BeginPlay."),
+	FConsoleCommandWithWorldAndArgsDelegate::CreateLambda([](const TArray<FString>& Args, UWorld* World)
+	{
+		for (TObjectIterator<UEasyEIBindingsComponent> It; It; ++It)
+		{
+			if (It->GetWorld() != World)
+			{
+				continue;
+			}
+
+			if (Args.IsEmpty())
+			{
+				It->StopInputReplay();
+			}
+			else if (IFileManager::Get().FileExists(*GetRecordingFilename(Args[0], *It)))
+			{
+				It->StartInputReplay(GetRecordingFilename(Args[0], *It));
+			}
+		}
+	}));
+
+static FAutoConsoleCommandWithWorld CmdDumpThrottling(
+	TEXT("EasyEIBindings.DumpThrottling"),
+	TEXT("Logs how many events each rate limited binding has dropped or merged."),
+	FConsoleCommandWithWorldDelegate::CreateLambda([](UWorld* World)
+	{
+		for (TObjectIterator<UEasyEIBindingsComponent> It; It; ++It)
+		{
+			if (It->GetWorld() == World)
+			{
+				It->DumpThrottledEvents(*GLog);
+			}
+		}
+	}));
+
+/**
+ * Parameters handlers are invoked with, laid out like Enhanced Input's dynamic handler signature
+ * so that handlers bound by name and dispatched handlers accept the same functions.
+ */
+struct FEasyEIHandlerParams
+{
+	FInputActionValue ActionValue;
+	float ElapsedSeconds = 0.f;
+	float TriggeredSeconds = 0.f;
+	const UInputAction* SourceAction = nullptr;
+};
+
+// Event slot of ETriggerEvent::Triggered, the only event that is coalesced
+static constexpr int32 TriggeredEventIndex = 0;
+
+// Ticks a possessed pawn waits for its input component before only its restart can bind it
+static constexpr int32 MaxPossessionRetries = 60;
+
+/** Calls a reflected handler with the dispatched parameters. */
+static void CallHandler(AActor* Owner, UFunction* Handler, const FInputActionValue& Value, float ElapsedSeconds,
+                        float TriggeredSeconds, const UInputAction* SourceAction)
+{
+	FEasyEIHandlerParams Params;
+	Params.ActionValue = Value;
+	Params.ElapsedSeconds = ElapsedSeconds;
+	Params.TriggeredSeconds = TriggeredSeconds;
+	Params.SourceAction = SourceAction;
+	Owner->ProcessEvent(Handler, &Params);
+}
 
 
 UEasyEIBindingsComponent::UEasyEIBindingsComponent()
 {
-	PrimaryComponentTick.bCanEverTick = false;
+	// Only ticks while a binding coalesces Triggered values
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+}
+
+void UEasyEIBindingsComponent::PostInitProperties()
+{
+	Super::PostInitProperties();
+
+	// Server RPCs need a replicated component. Decided before play, so the channel exists for the first packet.
+	if (bForwardToServer)
+	{
+		SetIsReplicatedByDefault(true);
+	}
+}
+
+void UEasyEIBindingsComponent::PostLoad()
+{
+	Super::PostLoad();
+
+	// Loaded instances only have their saved properties once PostInitProperties has run
+	if (bForwardToServer)
+	{
+		SetIsReplicatedByDefault(true);
+	}
 }
 
 void UEasyEIBindingsComponent::SetupInputActions(UEnhancedInputComponent* EnhancedInputComponent)
 {
+	SCOPE_CYCLE_COUNTER(STAT_EasyEIBindings_SetupInputActions);
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(EasyEIBindings_SetupInputActions, EasyEIBindingsChannel);
+
+	bSetupQueued = false;
+	InitializeActiveNamedSets();
+
 	AActor* Owner = GetOwner();
 	if (!Owner)
 	{
@@ -22,6 +217,12 @@ void UEasyEIBindingsComponent::SetupInputActions(UEnhancedInputComponent* Enhanc
 		return;
 	}
 
+	// Built before the input component check, the server replays forwarded input without one
+	if (bForwardToServer)
+	{
+		BuildForwardedActions();
+	}
+
 	if (!EnhancedInputComponent)
 	{
 		EnhancedInputComponent = Cast<UEnhancedInputComponent>(Owner->InputComponent);
@@ -33,79 +234,1969 @@ void UEasyEIBindingsComponent::SetupInputActions(UEnhancedInputComponent* Enhanc
 		return;
 	}
 
-	struct FBindSpec
+	if (!AcquireInputActions())
 	{
-		const TCHAR* Suffix;
-		ETriggerEvent Event;
-	} Specs[] = {
-		{TEXT("Triggered"), ETriggerEvent::Triggered},
-		{TEXT("Started"), ETriggerEvent::Started},
-		{TEXT("Ongoing"), ETriggerEvent::Ongoing},
-		{TEXT("Completed"), ETriggerEvent::Completed},
-		{TEXT("Canceled"), ETriggerEvent::Canceled}
-	};
+		PendingInputComponent = EnhancedInputComponent;
+		return;
+	}
+	PendingInputComponent = nullptr;
+
+	// A repeated setup releases the previous bindings first, their dispatch slot indices would point into the rebuilt table
+	if (UEnhancedInputComponent* PreviousInputComponent = BoundInputComponent.Get())
+	{
+		for (const TPair<FEasyEIBindingKey, FEasyEIBoundEvent>& Pair : BoundEvents)
+		{
+			PreviousInputComponent->RemoveBindingByHandle(Pair.Value.Handle);
+		}
+	}
 
-	BoundActionHandles.Empty();
+	BoundEvents.Reset();
+	DispatchSlots.Reset();
+	DispatchSlotIndices.Reset();
+	BoundInputComponent = EnhancedInputComponent;
 
-	for (const FEasyEIBinding& Binding : InputBindings)
+	if (ShouldWatchMappingContexts())
+	{
+		WatchMappingContexts();
+	}
+
+	if (!TakeDormantEvents())
+	{
+		GatherDesiredEvents(Owner, BoundEvents);
+	}
+	for (auto It = BoundEvents.CreateIterator(); It; ++It)
+	{
+		if (!BindEvent(*EnhancedInputComponent, Owner, It.Key(), It.Value()))
+		{
+			It.RemoveCurrent();
+		}
+	}
+
+	// Also picks up a new local player after possession, without a rebuild when nothing changed
+	if (!AppliedMappingContexts.IsEmpty() || !MappingContexts.IsEmpty() || !AddedMappingContexts.IsEmpty()
+		|| HaveMappingContexts(ActiveNamedSetMask))
+	{
+		bMappingContextsDirty = true;
+	}
+	UpdateDispatchTick();
+}
+
+void UEasyEIBindingsComponent::GatherDesiredEvents(const AActor* Owner,
+                                                   TMap<FEasyEIBindingKey, FEasyEIBoundEvent>& OutEvents) const
+{
+	FEasyEIBindingsCache& BindingCache = FEasyEIBindingsModule::Get().GetBindingCache();
+	const UClass* OwnerClass = Owner->GetClass();
+
+	for (int32 BindingIndex = 0; BindingIndex < InputBindings.Num(); ++BindingIndex)
 	{
-		if (!Binding.InputAction)
+		const FEasyEIBinding& Binding = InputBindings[BindingIndex];
+		const UInputAction* Action = Binding.GetInputAction();
+		if (!Action)
 		{
 			continue;
 		}
 
-		FString ActionName = Binding.InputAction->GetName();
-		ActionName.RemoveFromStart(TEXT("IA_"));
+		if (!IsActionMapped(Action))
+		{
+			continue;
+		}
+
+		if (const FEasyEIBakedBinding* Baked = FindBakedBinding(BindingIndex, OwnerClass))
+		{
+			// Baked names are validated once per class, later instances bind from the cache
+			GatherActionEvents(Binding, Action, Binding.GetEnabledEventSlots(),
+			                   BindingCache.FindOrSeed(OwnerClass, Action, Baked->HandlerNames), OutEvents);
+		}
+		else
+		{
+			GatherActionEvents(Binding, Action, Binding.GetEnabledEventSlots(),
+			                   BindingCache.FindOrResolve(OwnerClass, Action), OutEvents);
+		}
+	}
 
-		for (const FBindSpec& Spec : Specs)
+	if (BindingSet)
+	{
+		const FEasyEIResolvedBindingSet& ResolvedSet = BindingCache.FindOrResolveSet(OwnerClass, BindingSet);
+		for (const FEasyEIResolvedSetBinding& SetBinding : ResolvedSet.Bindings)
 		{
-			if (!Binding.IsEventEnabled(Spec.Event))
+			if (OverridesAction(SetBinding.Action))
+			{
+				continue;
+			}
+
+			if (!IsActionMapped(SetBinding.Action))
 			{
 				continue;
 			}
 
-			FString FuncStr = FString::Printf(TEXT("IA_%s_%s"), *ActionName, Spec.Suffix);
-			FName FuncName(*FuncStr);
+			GatherActionEvents(BindingSet->Bindings[SetBinding.BindingIndex], SetBinding.Action,
+			                   SetBinding.EnabledEventSlots, SetBinding.Resolved, OutEvents);
+		}
+	}
+
+	// Gathered last, so events the other bindings already deliver stay ungated
+	const int32 NumNamedSets = FMath::Min(NamedBindingSets.Num(), MaxNamedBindingSets);
+	UE_CLOG(NamedBindingSets.Num() > MaxNamedBindingSets, LogEasyEIBindings, Warning,
+	        TEXT("%hs: %s has %d named binding sets, only the first %d are bound."), __FUNCTION__, *GetPathName(),
+	        NamedBindingSets.Num(), MaxNamedBindingSets);
 
-			if (Owner->FindFunction(FuncName))
+	for (int32 SetIndex = 0; SetIndex < NumNamedSets; ++SetIndex)
+	{
+		for (const FEasyEIBinding& Binding : NamedBindingSets[SetIndex].Bindings)
+		{
+			const UInputAction* Action = Binding.GetInputAction();
+			if (!Action || !IsActionMapped(Action))
 			{
-				FEnhancedInputActionEventBinding& ActionBinding = EnhancedInputComponent->BindAction(
-					Binding.InputAction, Spec.Event, Owner, FuncName);
-				BoundActionHandles.Add(ActionBinding.GetHandle());
+				continue;
 			}
+
+			GatherActionEvents(Binding, Action, Binding.GetEnabledEventSlots(),
+			                   BindingCache.FindOrResolve(OwnerClass, Action), OutEvents, 1u << SetIndex);
 		}
 	}
 }
 
-void UEasyEIBindingsComponent::RebindInputActions()
+void UEasyEIBindingsComponent::GatherActionEvents(const FEasyEIBinding& Binding, const UInputAction* Action,
+                                                  uint8 EnabledEventSlots, const FEasyEIResolvedAction& Resolved,
+                                                  TMap<FEasyEIBindingKey, FEasyEIBoundEvent>& OutEvents,
+                                                  uint32 NamedSetMask) const
 {
-	ClearInputBindings();
-	SetupInputActions();
+	const bool bDispatch = UsesComponentDispatch();
+
+	for (int32 EventIndex = 0; EventIndex < EasyEIBindings::NumTriggerEvents; ++EventIndex)
+	{
+		if ((EnabledEventSlots & (1 << EventIndex)) == 0)
+		{
+			continue;
+		}
+
+		const ETriggerEvent Event = EasyEIBindings::GetTriggerEvent(EventIndex);
+		const FEasyEIBindingKey Key(Action, Event);
+		if (NamedSetMask != 0)
+		{
+			// Several sets enabling the same event share one binding
+			if (FEasyEIBoundEvent* Existing = OutEvents.Find(Key))
+			{
+				if (Existing->NamedSetMask != 0)
+				{
+					Existing->NamedSetMask |= NamedSetMask;
+				}
+				continue;
+			}
+		}
+
+		if (FindNativeHandler(Action, Event))
+		{
+			FEasyEIBoundEvent& Desired = OutEvents.Add(Key);
+			Desired.EventIndex = EventIndex;
+			Desired.bNative = true;
+			continue;
+		}
+
+		if (UFunction* Function = Resolved.Handlers[EventIndex])
+		{
+			FEasyEIBoundEvent& Desired = OutEvents.Add(Key);
+			Desired.HandlerName = Resolved.HandlerNames[EventIndex];
+			Desired.Function = Function;
+			Desired.EventIndex = EventIndex;
+			Desired.bDispatched = bDispatch;
+
+			// Coalescing needs the dispatcher to hold values until the tick
+			if (EventIndex == TriggeredEventIndex && Binding.TriggeredCoalescing != EEasyEIValueCoalescing::None)
+			{
+				Desired.bDispatched = true;
+				Desired.Coalescing = Binding.TriggeredCoalescing;
+				Desired.CoalesceEpsilon = Binding.CoalesceEpsilon;
+			}
+
+			// Throttling is enforced by the dispatcher
+			Desired.MinDispatchInterval = Binding.GetMinDispatchInterval(Event);
+			if (Desired.MinDispatchInterval > 0.f)
+			{
+				Desired.bDispatched = true;
+				Desired.ThrottleMode = Binding.ThrottleMode;
+			}
+
+			// Set membership is checked by the dispatcher
+			Desired.NamedSetMask = NamedSetMask;
+			if (NamedSetMask != 0)
+			{
+				Desired.bDispatched = true;
+			}
+		}
+	}
 }
 
-void UEasyEIBindingsComponent::ClearInputBindings()
+bool UEasyEIBindingsComponent::OverridesAction(const UInputAction* Action) const
 {
-	AActor* Owner = GetOwner();
-	if (!Owner)
+	return InputBindings.ContainsByPredicate([Action](const FEasyEIBinding& Binding)
+	{
+		return Binding.GetInputAction() == Action;
+	});
+}
+
+void UEasyEIBindingsComponent::SetBindingSet(UEasyEIBindingSet* NewBindingSet)
+{
+	if (BindingSet == NewBindingSet)
 	{
 		return;
 	}
 
-	UEnhancedInputComponent* EnhancedInputComponent = Cast<UEnhancedInputComponent>(Owner->InputComponent);
-	if (!EnhancedInputComponent)
+	// The old set's handle goes with it, its actions unload once no other component holds them
+	StopWaitingForInputActions();
+	BindingSetLoadHandle.Reset();
+
+	BindingSet = NewBindingSet;
+	if (BoundInputComponent.IsValid())
+	{
+		RebindInputActions();
+	}
+}
+
+void UEasyEIBindingsComponent::ActivateNamedBindingSet(FName SetName)
+{
+	const int32 SetIndex = FindNamedBindingSet(SetName);
+	if (SetIndex == INDEX_NONE && !SetName.IsNone())
 	{
+		UE_LOG(LogEasyEIBindings, Warning, TEXT("%hs: No named binding set %s."), __FUNCTION__, *SetName.ToString());
 		return;
 	}
 
-	for (uint32 Handle : BoundActionHandles)
+	InitializeActiveNamedSets();
+	const uint32 PreviousMask = ActiveNamedSetMask;
+	ActiveNamedSetMask = SetIndex != INDEX_NONE ? 1u << SetIndex : 0;
+
+	if (HaveMappingContexts(PreviousMask ^ ActiveNamedSetMask))
 	{
-		EnhancedInputComponent->RemoveBindingByHandle(Handle);
+		MarkMappingContextsDirty();
 	}
-	BoundActionHandles.Empty();
 }
 
-void UEasyEIBindingsComponent::BeginPlay()
+void UEasyEIBindingsComponent::SetNamedBindingSetActive(FName SetName, bool bActive)
 {
-	Super::BeginPlay();
-	SetupInputActions();
+	const int32 SetIndex = FindNamedBindingSet(SetName);
+	if (SetIndex == INDEX_NONE)
+	{
+		UE_LOG(LogEasyEIBindings, Warning, TEXT("%hs: No named binding set %s."), __FUNCTION__, *SetName.ToString());
+		return;
+	}
+
+	InitializeActiveNamedSets();
+	const uint32 PreviousMask = ActiveNamedSetMask;
+	if (bActive)
+	{
+		ActiveNamedSetMask |= 1u << SetIndex;
+	}
+	else
+	{
+		ActiveNamedSetMask &= ~(1u << SetIndex);
+	}
+
+	if (HaveMappingContexts(PreviousMask ^ ActiveNamedSetMask))
+	{
+		MarkMappingContextsDirty();
+	}
+}
+
+bool UEasyEIBindingsComponent::IsNamedBindingSetActive(FName SetName) const
+{
+	const int32 SetIndex = FindNamedBindingSet(SetName);
+	if (SetIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	return bActiveNamedSetsInitialized
+		       ? (ActiveNamedSetMask & (1u << SetIndex)) != 0
+		       : NamedBindingSets[SetIndex].bActiveByDefault;
+}
+
+void UEasyEIBindingsComponent::AddMappingContext(UInputMappingContext* MappingContext, int32 Priority)
+{
+	if (!MappingContext)
+	{
+		return;
+	}
+
+	AddedMappingContexts.Add(MappingContext, Priority);
+	MarkMappingContextsDirty();
+}
+
+void UEasyEIBindingsComponent::RemoveMappingContext(UInputMappingContext* MappingContext)
+{
+	if (AddedMappingContexts.Remove(MappingContext) > 0)
+	{
+		MarkMappingContextsDirty();
+	}
+}
+
+void UEasyEIBindingsComponent::FlushMappingContexts()
+{
+	if (!bMappingContextsDirty)
+	{
+		return;
+	}
+	bMappingContextsDirty = false;
+
+	// Contexts are only applied while the bindings are set up
+	UEnhancedInputLocalPlayerSubsystem* Subsystem = BoundInputComponent.IsValid() ? GetEnhancedInputSubsystem() : nullptr;
+	if (MappingContextSubsystem.Get() != Subsystem)
+	{
+		// Possessed by another player or unpossessed, the contexts move with the bindings
+		ReleaseMappingContexts();
+	}
+
+	if (Subsystem)
+	{
+		TMap<UInputMappingContext*, int32> DesiredContexts;
+		GatherDesiredMappingContexts(DesiredContexts);
+
+		// Deferred rebuilds, Enhanced Input rebuilds the mappings once for the whole batch
+		FModifyContextOptions Options;
+		Options.bForceImmediately = false;
+
+		for (auto It = AppliedMappingContexts.CreateIterator(); It; ++It)
+		{
+			const int32* Priority = DesiredContexts.Find(It.Key());
+			if (!Priority)
+			{
+				Subsystem->RemoveMappingContext(It.Key(), Options);
+				It.RemoveCurrent();
+			}
+			else if (*Priority == It.Value())
+			{
+				DesiredContexts.Remove(It.Key());
+			}
+		}
+
+		// Re-adding an applied context replaces its priority
+		for (const TPair<UInputMappingContext*, int32>& Pair : DesiredContexts)
+		{
+			Subsystem->AddMappingContext(Pair.Key, Pair.Value, Options);
+			AppliedMappingContexts.Add(Pair.Key, Pair.Value);
+		}
+
+		MappingContextSubsystem = AppliedMappingContexts.IsEmpty() ? nullptr : Subsystem;
+	}
+
+	UpdateDispatchTick();
+}
+
+void UEasyEIBindingsComponent::GatherDesiredMappingContexts(TMap<UInputMappingContext*, int32>& OutContexts) const
+{
+	auto AddContext = [&OutContexts](UInputMappingContext* MappingContext, int32 Priority)
+	{
+		if (MappingContext)
+		{
+			int32& DesiredPriority = OutContexts.FindOrAdd(MappingContext, Priority);
+			DesiredPriority = FMath::Max(DesiredPriority, Priority);
+		}
+	};
+
+	for (const FEasyEIMappingContext& Entry : MappingContexts)
+	{
+		AddContext(Entry.MappingContext, Entry.Priority);
+	}
+
+	const int32 NumNamedSets = FMath::Min(NamedBindingSets.Num(), MaxNamedBindingSets);
+	for (int32 SetIndex = 0; SetIndex < NumNamedSets; ++SetIndex)
+	{
+		if (ActiveNamedSetMask & (1u << SetIndex))
+		{
+			for (const FEasyEIMappingContext& Entry : NamedBindingSets[SetIndex].MappingContexts)
+			{
+				AddContext(Entry.MappingContext, Entry.Priority);
+			}
+		}
+	}
+
+	for (const TPair<TObjectPtr<UInputMappingContext>, int32>& Pair : AddedMappingContexts)
+	{
+		AddContext(Pair.Key, Pair.Value);
+	}
+}
+
+bool UEasyEIBindingsComponent::HaveMappingContexts(uint32 NamedSetMask) const
+{
+	const int32 NumNamedSets = FMath::Min(NamedBindingSets.Num(), MaxNamedBindingSets);
+	for (int32 SetIndex = 0; SetIndex < NumNamedSets; ++SetIndex)
+	{
+		if ((NamedSetMask & (1u << SetIndex)) && !NamedBindingSets[SetIndex].MappingContexts.IsEmpty())
+		{
+			return true;
+		}
+	}
+	return false;
+}
+
+void UEasyEIBindingsComponent::MarkMappingContextsDirty()
+{
+	if (!bMappingContextsDirty)
+	{
+		bMappingContextsDirty = true;
+		UpdateDispatchTick();
+	}
+}
+
+void UEasyEIBindingsComponent::ReleaseMappingContexts()
+{
+	if (UEnhancedInputLocalPlayerSubsystem* Subsystem = MappingContextSubsystem.Get())
+	{
+		FModifyContextOptions Options;
+		Options.bForceImmediately = false;
+		for (const TPair<TObjectPtr<UInputMappingContext>, int32>& Pair : AppliedMappingContexts)
+		{
+			Subsystem->RemoveMappingContext(Pair.Key, Options);
+		}
+	}
+
+	AppliedMappingContexts.Reset();
+	MappingContextSubsystem = nullptr;
+}
+
+int32 UEasyEIBindingsComponent::FindNamedBindingSet(FName SetName) const
+{
+	const int32 NumNamedSets = FMath::Min(NamedBindingSets.Num(), MaxNamedBindingSets);
+	for (int32 SetIndex = 0; SetIndex < NumNamedSets; ++SetIndex)
+	{
+		if (NamedBindingSets[SetIndex].Name == SetName)
+		{
+			return SetIndex;
+		}
+	}
+	return INDEX_NONE;
+}
+
+void UEasyEIBindingsComponent::InitializeActiveNamedSets()
+{
+	if (bActiveNamedSetsInitialized)
+	{
+		return;
+	}
+	bActiveNamedSetsInitialized = true;
+
+	ActiveNamedSetMask = 0;
+	const int32 NumNamedSets = FMath::Min(NamedBindingSets.Num(), MaxNamedBindingSets);
+	for (int32 SetIndex = 0; SetIndex < NumNamedSets; ++SetIndex)
+	{
+		if (NamedBindingSets[SetIndex].bActiveByDefault)
+		{
+			ActiveNamedSetMask |= 1u << SetIndex;
+		}
+	}
+}
+
+bool UEasyEIBindingsComponent::BindEvent(UEnhancedInputComponent& EnhancedInputComponent, AActor* Owner,
+                                         const FEasyEIBindingKey& Key, FEasyEIBoundEvent& InOutEvent)
+{
+	if (InOutEvent.bNative)
+	{
+		const FEasyEINativeHandler* NativeHandler = FindNativeHandler(Key.Action, Key.Event);
+		if (!NativeHandler)
+		{
+			return false;
+		}
+
+		InOutEvent.Handle = NativeHandler->Bind(EnhancedInputComponent, Key.Action, Key.Event).GetHandle();
+		return true;
+	}
+
+	if (!InOutEvent.bDispatched)
+	{
+		InOutEvent.Handle = EnhancedInputComponent.BindAction(Key.Action, Key.Event, Owner, InOutEvent.HandlerName).GetHandle();
+		return true;
+	}
+
+	// Handlers taking more than the dispatched parameters cannot be called safely
+	if (InOutEvent.Function->ParmsSize > sizeof(FEasyEIHandlerParams))
+	{
+		UE_LOG(LogEasyEIBindings, Warning, TEXT("%hs: %s has an unsupported signature and was not bound."),
+		       __FUNCTION__, *InOutEvent.HandlerName.ToString());
+		return false;
+	}
+
+	int32& SlotIndex = DispatchSlotIndices.FindOrAdd(Key.Action, INDEX_NONE);
+	if (SlotIndex == INDEX_NONE)
+	{
+		SlotIndex = DispatchSlots.AddDefaulted();
+		DispatchSlots[SlotIndex].Action = Key.Action;
+	}
+
+	FEasyEIDispatchSlot& Slot = DispatchSlots[SlotIndex];
+	Slot.Handlers[InOutEvent.EventIndex] = InOutEvent.Function;
+	if (InOutEvent.Coalescing != EEasyEIValueCoalescing::None)
+	{
+		Slot.Coalescing = InOutEvent.Coalescing;
+		Slot.CoalesceEpsilon = InOutEvent.CoalesceEpsilon;
+		Slot.bHasPendingValue = false;
+		Slot.bHasDeliveredValue = false;
+	}
+
+	FEasyEIThrottleState& Throttle = Slot.Throttles[InOutEvent.EventIndex];
+	Throttle = FEasyEIThrottleState();
+	Throttle.MinInterval = InOutEvent.MinDispatchInterval;
+	Throttle.Mode = InOutEvent.ThrottleMode;
+	Slot.NamedSetMasks[InOutEvent.EventIndex] = InOutEvent.NamedSetMask;
+
+	if (bForwardToServer && Slot.ForwardIndex == INDEX_NONE)
+	{
+		Slot.ForwardIndex = FindForwardedAction(Key.Action);
+	}
+
+	InOutEvent.Handle = EnhancedInputComponent.BindAction(Key.Action, Key.Event, this,
+	                                                      &UEasyEIBindingsComponent::DispatchActionEvent,
+	                                                      SlotIndex, InOutEvent.EventIndex).GetHandle();
+	return true;
+}
+
+void UEasyEIBindingsComponent::ReleaseEvent(UEnhancedInputComponent* EnhancedInputComponent,
+                                            const FEasyEIBindingKey& Key, const FEasyEIBoundEvent& BoundEvent)
+{
+	if (EnhancedInputComponent)
+	{
+		EnhancedInputComponent->RemoveBindingByHandle(BoundEvent.Handle);
+	}
+
+	if (BoundEvent.bDispatched)
+	{
+		if (const int32* SlotIndex = DispatchSlotIndices.Find(Key.Action))
+		{
+			FEasyEIDispatchSlot& Slot = DispatchSlots[*SlotIndex];
+			Slot.Handlers[BoundEvent.EventIndex] = nullptr;
+			if (BoundEvent.Coalescing != EEasyEIValueCoalescing::None)
+			{
+				Slot.Coalescing = EEasyEIValueCoalescing::None;
+				Slot.bHasPendingValue = false;
+			}
+			Slot.Throttles[BoundEvent.EventIndex] = FEasyEIThrottleState();
+			Slot.NamedSetMasks[BoundEvent.EventIndex] = 0;
+		}
+	}
+}
+
+void UEasyEIBindingsComponent::UnbindEvent(const FEasyEIBindingKey& Key)
+{
+	FEasyEIBoundEvent BoundEvent;
+	if (BoundEvents.RemoveAndCopyValue(Key, BoundEvent))
+	{
+		ReleaseEvent(BoundInputComponent.Get(), Key, BoundEvent);
+	}
+}
+
+bool UEasyEIBindingsComponent::UsesComponentDispatch() const
+{
+	return bDispatchThroughComponent || bMeasureInputLatency || bForwardToServer || InputRecorder || InputPlayer
+		|| CVarTraceHandlers.GetValueOnGameThread();
+}
+
+void UEasyEIBindingsComponent::DispatchActionEvent(const FInputActionInstance& Instance, int32 SlotIndex,
+                                                   int32 EventIndex)
+{
+	if (!DispatchSlots.IsValidIndex(SlotIndex) || !DispatchSlots[SlotIndex].Handlers[EventIndex])
+	{
+		return;
+	}
+
+	// Live input is ignored while a recording drives the handlers
+	if (InputPlayer)
+	{
+		return;
+	}
+
+	FEasyEIDispatchSlot& Slot = DispatchSlots[SlotIndex];
+	if (!IsDispatchedEventActive(Slot, EventIndex))
+	{
+		return;
+	}
+	if (Slot.Coalescing != EEasyEIValueCoalescing::None)
+	{
+		if (EventIndex == TriggeredEventIndex)
+		{
+			INC_DWORD_STAT(STAT_EasyEIBindings_CoalescedEvents);
+
+			const FInputActionValue Value = Instance.GetValue();
+			Slot.PendingValue = Slot.Coalescing == EEasyEIValueCoalescing::Sum && Slot.bHasPendingValue
+				                    ? FInputActionValue(Value.GetValueType(), Slot.PendingValue.Get<FVector>() + Value.Get<FVector>())
+				                    : Value;
+			Slot.PendingElapsedSeconds = Instance.GetElapsedTime();
+			Slot.PendingTriggeredSeconds = Instance.GetTriggeredTime();
+			Slot.bHasPendingValue = true;
+			return;
+		}
+
+		// Keep Triggered ahead of the Completed or Canceled that ends it
+		FlushCoalescedValue(Slot);
+	}
+
+	InvokeHandler(Slot, EventIndex, Instance.GetValue(), Instance.GetElapsedTime(), Instance.GetTriggeredTime());
+}
+
+void UEasyEIBindingsComponent::InvokeHandler(FEasyEIDispatchSlot& Slot, int32 EventIndex, const FInputActionValue& Value,
+                                             float ElapsedSeconds, float TriggeredSeconds)
+{
+	AActor* Owner = GetOwner();
+	UFunction* Handler = Slot.Handlers[EventIndex];
+	if (!Owner || !Handler)
+	{
+		return;
+	}
+
+	FEasyEIThrottleState& Throttle = Slot.Throttles[EventIndex];
+	const UWorld* World = GetWorld();
+	if (Throttle.MinInterval > 0.f && World)
+	{
+		const double NowSeconds = World->GetTimeSeconds();
+		if (NowSeconds - Throttle.LastDispatchSeconds < Throttle.MinInterval)
+		{
+			INC_DWORD_STAT(STAT_EasyEIBindings_ThrottledEvents);
+			++ThrottledEventCounts.FindOrAdd(Slot.Action);
+
+			if (Throttle.Mode == EEasyEIThrottleMode::Merge)
+			{
+				Throttle.MergedValue = Value;
+				Throttle.MergedElapsedSeconds = ElapsedSeconds;
+				Throttle.MergedTriggeredSeconds = TriggeredSeconds;
+				Throttle.bHasMergedEvent = true;
+			}
+			return;
+		}
+
+		Throttle.LastDispatchSeconds = NowSeconds;
+		Throttle.bHasMergedEvent = false;
+	}
+
+	DeliverToHandler(Slot, EventIndex, Value, ElapsedSeconds, TriggeredSeconds);
+}
+
+void UEasyEIBindingsComponent::DeliverToHandler(FEasyEIDispatchSlot& Slot, int32 EventIndex,
+                                                const FInputActionValue& Value, float ElapsedSeconds,
+                                                float TriggeredSeconds)
+{
+	AActor* Owner = GetOwner();
+	UFunction* Handler = Slot.Handlers[EventIndex];
+	if (!Owner || !Handler)
+	{
+		return;
+	}
+
+	// Coalesced and merged values held across a switch are dropped with their set
+	if (!IsDispatchedEventActive(Slot, EventIndex))
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_EasyEIBindings_DispatchHandler);
+	INC_DWORD_STAT(STAT_EasyEIBindings_DispatchedEvents);
+
+#if CPUPROFILERTRACE_ENABLED
+	const bool bTraceHandler = UE_TRACE_CHANNELEXPR_IS_ENABLED(EasyEIBindingsChannel);
+	if (bTraceHandler && Slot.TraceNames[EventIndex].IsEmpty())
+	{
+		// Carries the action and trigger event, e.g. "IA_Move [Triggered]"
+		Slot.TraceNames[EventIndex] = FString::Printf(TEXT("%s [%s]"), *GetNameSafe(Slot.Action),
+		                                              EasyEIBindings::GetTriggerEventSuffix(EventIndex));
+	}
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT_ON_CHANNEL(bTraceHandler ? *Slot.TraceNames[EventIndex] : TEXT(""),
+	                                              EasyEIBindingsChannel);
+#endif
+
+	if (bMeasureInputLatency)
+	{
+		RecordInputLatency(Slot);
+	}
+
+	if (ShouldForwardToServer())
+	{
+		RecordForwardedEvent(Slot, EventIndex, Value);
+	}
+
+	if (InputRecorder)
+	{
+		InputRecorder->Record(Slot.Action, EventIndex, Value);
+	}
+
+	CallHandler(Owner, Handler, Value, ElapsedSeconds, TriggeredSeconds, Slot.Action);
+}
+
+void UEasyEIBindingsComponent::TickComponent(float DeltaTime, ELevelTick TickType,
+                                             FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	AdvanceInputReplay();
+	FlushMappingContexts();
+	FlushCoalescedValues();
+	FlushMergedEvents();
+	if (ShouldFlushForwardedInput())
+	{
+		FlushForwardedInput();
+	}
+}
+
+void UEasyEIBindingsComponent::FlushCoalescedValues()
+{
+	// Handlers may rebind, which can grow the slot array
+	for (int32 SlotIndex = 0; SlotIndex < DispatchSlots.Num(); ++SlotIndex)
+	{
+		FEasyEIDispatchSlot& Slot = DispatchSlots[SlotIndex];
+		if (Slot.Coalescing == EEasyEIValueCoalescing::None)
+		{
+			continue;
+		}
+
+		if (!Slot.bHasPendingValue)
+		{
+			// Triggered stopped firing, so the next value is delivered even if it repeats the last one
+			Slot.bHasDeliveredValue = false;
+			continue;
+		}
+
+		FlushCoalescedValue(Slot);
+	}
+}
+
+void UEasyEIBindingsComponent::FlushCoalescedValue(FEasyEIDispatchSlot& Slot)
+{
+	if (!Slot.bHasPendingValue)
+	{
+		return;
+	}
+	Slot.bHasPendingValue = false;
+
+	// Sums are deltas, so a near zero sum carries nothing; latest values are compared with the last call
+	const FVector Reference = Slot.Coalescing == EEasyEIValueCoalescing::Latest && Slot.bHasDeliveredValue
+		                          ? Slot.LastDeliveredValue.Get<FVector>()
+		                          : FVector::ZeroVector;
+	const bool bCompare = Slot.Coalescing == EEasyEIValueCoalescing::Sum || Slot.bHasDeliveredValue;
+	if (bCompare && (Slot.PendingValue.Get<FVector>() - Reference).IsNearlyZero(Slot.CoalesceEpsilon))
+	{
+		INC_DWORD_STAT(STAT_EasyEIBindings_SuppressedDeliveries);
+		return;
+	}
+
+	Slot.LastDeliveredValue = Slot.PendingValue;
+	Slot.bHasDeliveredValue = true;
+	InvokeHandler(Slot, TriggeredEventIndex, Slot.LastDeliveredValue, Slot.PendingElapsedSeconds,
+	              Slot.PendingTriggeredSeconds);
+}
+
+void UEasyEIBindingsComponent::FlushMergedEvents()
+{
+	const UWorld* World = GetWorld();
+	if (!World)
+	{
+		return;
+	}
+
+	const double NowSeconds = World->GetTimeSeconds();
+	for (int32 SlotIndex = 0; SlotIndex < DispatchSlots.Num(); ++SlotIndex)
+	{
+		for (int32 EventIndex = 0; EventIndex < EasyEIBindings::NumTriggerEvents; ++EventIndex)
+		{
+			FEasyEIThrottleState& Throttle = DispatchSlots[SlotIndex].Throttles[EventIndex];
+			if (Throttle.bHasMergedEvent && NowSeconds - Throttle.LastDispatchSeconds >= Throttle.MinInterval)
+			{
+				const FInputActionValue MergedValue = Throttle.MergedValue;
+				InvokeHandler(DispatchSlots[SlotIndex], EventIndex, MergedValue, Throttle.MergedElapsedSeconds,
+				              Throttle.MergedTriggeredSeconds);
+			}
+		}
+	}
+}
+
+bool UEasyEIBindingsComponent::ShouldForwardToServer() const
+{
+	const AActor* Owner = GetOwner();
+	return bForwardToServer && Owner && Owner->GetLocalRole() == ROLE_AutonomousProxy;
+}
+
+void UEasyEIBindingsComponent::BuildForwardedActions()
+{
+	ForwardedActions.Reset();
+
+	// Paths rather than loaded actions, so the order does not depend on which soft actions have loaded
+	auto AddBinding = [this](const FEasyEIBinding& Binding)
+	{
+		const FSoftObjectPath ActionPath = Binding.InputAction
+			                                   ? FSoftObjectPath(Binding.InputAction.Get())
+			                                   : Binding.SoftInputAction.ToSoftObjectPath();
+		const bool bKnown = ForwardedActions.ContainsByPredicate([&ActionPath](const FEasyEIForwardedAction& Forwarded)
+		{
+			return Forwarded.Action == ActionPath;
+		});
+
+		// Overrides come first, so a set entry for the same action is skipped
+		if (!ActionPath.IsNull() && !bKnown)
+		{
+			ForwardedActions.Add({ActionPath, Binding.GetEnabledEventSlots()});
+		}
+	};
+
+	for (const FEasyEIBinding& Binding : InputBindings)
+	{
+		AddBinding(Binding);
+	}
+
+	if (BindingSet)
+	{
+		for (const FEasyEIBinding& Binding : BindingSet->Bindings)
+		{
+			AddBinding(Binding);
+		}
+	}
+
+	for (const FEasyEINamedBindingSet& NamedSet : NamedBindingSets)
+	{
+		for (const FEasyEIBinding& Binding : NamedSet.Bindings)
+		{
+			AddBinding(Binding);
+		}
+	}
+
+	ForwardedTableHash = 0;
+	for (const FEasyEIForwardedAction& Forwarded : ForwardedActions)
+	{
+		ForwardedTableHash = HashCombine(ForwardedTableHash, GetTypeHash(Forwarded.Action));
+		ForwardedTableHash = HashCombine(ForwardedTableHash, GetTypeHash(Forwarded.EnabledEventSlots));
+	}
+
+	for (FEasyEIDispatchSlot& Slot : DispatchSlots)
+	{
+		Slot.ForwardIndex = FindForwardedAction(Slot.Action);
+	}
+}
+
+int32 UEasyEIBindingsComponent::FindForwardedAction(const UInputAction* Action) const
+{
+	const FSoftObjectPath ActionPath(Action);
+	return ForwardedActions.IndexOfByPredicate([&ActionPath](const FEasyEIForwardedAction& Forwarded)
+	{
+		return Forwarded.Action == ActionPath;
+	});
+}
+
+void UEasyEIBindingsComponent::RecordForwardedEvent(const FEasyEIDispatchSlot& Slot, int32 EventIndex,
+                                                    const FInputActionValue& Value)
+{
+	if (Slot.ForwardIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	FEasyEIForwardedEvent& Event = PendingForwardedInput.Events.AddDefaulted_GetRef();
+	Event.ActionIndex = static_cast<uint16>(Slot.ForwardIndex);
+	Event.EventIndex = static_cast<uint8>(EventIndex);
+	Event.Value = Value;
+
+	if (PendingForwardedInput.Events.Num() >= FEasyEIForwardedInput::MaxEvents)
+	{
+		FlushForwardedInput();
+	}
+}
+
+void UEasyEIBindingsComponent::FlushForwardedInput()
+{
+	if (PendingForwardedInput.Events.IsEmpty())
+	{
+		return;
+	}
+
+	const int64 NumBits = PendingForwardedInput.GetNumBits();
+	ForwardedBitsSent += NumBits;
+	++ForwardingStats.PacketsSent;
+	ForwardingStats.EventsSent += PendingForwardedInput.Events.Num();
+	INC_DWORD_STAT_BY(STAT_EasyEIBindings_ForwardedBitsSent, NumBits);
+
+	PendingForwardedInput.TableHash = ForwardedTableHash;
+	ServerForwardInput(PendingForwardedInput);
+	PendingForwardedInput.Events.Reset();
+
+	const UWorld* World = GetWorld();
+	LastForwardFlushSeconds = World ? World->GetRealTimeSeconds() : 0.0;
+}
+
+bool UEasyEIBindingsComponent::ShouldFlushForwardedInput() const
+{
+	const AActor* Owner = GetOwner();
+	const UWorld* World = GetWorld();
+	if (PendingForwardedInput.Events.IsEmpty() || !Owner || !World)
+	{
+		return false;
+	}
+
+#if UE_VERSION_OLDER_THAN(5, 5, 0)
+	const float NetUpdateFrequency = Owner->NetUpdateFrequency;
+#else
+	const float NetUpdateFrequency = Owner->GetNetUpdateFrequency();
+#endif
+
+	// Real time, packets keep flowing while the game is paused or dilated
+	return NetUpdateFrequency <= 0.f || World->GetRealTimeSeconds() - LastForwardFlushSeconds >= 1.0 / NetUpdateFrequency;
+}
+
+void UEasyEIBindingsComponent::ServerForwardInput_Implementation(const FEasyEIForwardedInput& Packet)
+{
+	AActor* Owner = GetOwner();
+	if (!Owner)
+	{
+		return;
+	}
+
+	const int64 NumBits = Packet.GetNumBits();
+	ForwardedBitsReceived += NumBits;
+	++ForwardingStats.PacketsReceived;
+	ForwardingStats.EventsReceived += Packet.Events.Num();
+	INC_DWORD_STAT_BY(STAT_EasyEIBindings_ForwardedBitsReceived, NumBits);
+
+	if (!bForwardToServer)
+	{
+		ForwardingStats.EventsRejected += Packet.Events.Num();
+		return;
+	}
+
+	// Binding changes on this side rebuild the table when they rebind. A new mismatched hash rebuilds once more in
+	// case the server's bindings changed without a rebind, e.g. through a replicated SetBindingSet. A table that
+	// still differs means the client changed bindings the server does not know about, so later packets built
+	// against it are dropped without rebuilding.
+	if (Packet.TableHash != ForwardedTableHash && Packet.TableHash != RejectedTableHash)
+	{
+		BuildForwardedActions();
+		if (Packet.TableHash != ForwardedTableHash)
+		{
+			UE_LOG(LogEasyEIBindings, Warning,
+			       TEXT("%hs: %s received input built against a different action table, dropping it until the bindings match."),
+			       __FUNCTION__, *GetNameSafe(Owner));
+			RejectedTableHash = Packet.TableHash;
+		}
+	}
+
+	if (Packet.TableHash != ForwardedTableHash)
+	{
+		++ForwardingStats.PacketsRejected;
+		ForwardingStats.EventsRejected += Packet.Events.Num();
+		return;
+	}
+
+	for (const FEasyEIForwardedEvent& Event : Packet.Events)
+	{
+		// Only events the server's own bindings enable are replayed
+		const bool bKnownEvent = ForwardedActions.IsValidIndex(Event.ActionIndex)
+			&& Event.EventIndex < EasyEIBindings::NumTriggerEvents
+			&& (ForwardedActions[Event.ActionIndex].EnabledEventSlots & (1 << Event.EventIndex)) != 0;
+		const UInputAction* Action = bKnownEvent
+			                             ? Cast<UInputAction>(ForwardedActions[Event.ActionIndex].Action.ResolveObject())
+			                             : nullptr;
+		if (!Action)
+		{
+			++ForwardingStats.EventsRejected;
+			continue;
+		}
+
+		InvokeUnboundHandler(Action, Event.EventIndex, Event.Value);
+	}
+}
+
+void UEasyEIBindingsComponent::InvokeUnboundHandler(const UInputAction* Action, int32 EventIndex,
+                                                    const FInputActionValue& Value)
+{
+	AActor* Owner = GetOwner();
+	if (!Owner)
+	{
+		return;
+	}
+
+	UFunction* Handler = FEasyEIBindingsModule::Get().GetBindingCache().FindOrResolve(Owner->GetClass(), Action).Handlers[EventIndex];
+	if (Handler && Handler->ParmsSize <= sizeof(FEasyEIHandlerParams))
+	{
+		CallHandler(Owner, Handler, Value, 0.f, 0.f, Action);
+	}
+}
+
+bool UEasyEIBindingsComponent::StartInputRecording(const FString& Filename)
+{
+	StopInputRecording();
+
+	InputRecorder = FEasyEIInputRecorder::Create(Filename);
+	if (!InputRecorder)
+	{
+		return false;
+	}
+
+	// Recording hooks the dispatcher, so bindings made by name move over to it
+	if (BoundInputComponent.IsValid())
+	{
+		RebindInputActions();
+	}
+
+	UE_LOG(LogEasyEIBindings, Log, TEXT("%hs: Recording %s input to %s."), __FUNCTION__, *GetNameSafe(GetOwner()), *Filename);
+	return true;
+}
+
+void UEasyEIBindingsComponent::StopInputRecording()
+{
+	if (!InputRecorder)
+	{
+		return;
+	}
+
+	InputRecorder->Close();
+	UE_LOG(LogEasyEIBindings, Log, TEXT("%hs: Recorded %lld event(s) in %lld bytes for %s."), __FUNCTION__,
+	       InputRecorder->GetNumEvents(), InputRecorder->GetNumBytesWritten(), *GetNameSafe(GetOwner()));
+	InputRecorder.Reset();
+
+	if (BoundInputComponent.IsValid())
+	{
+		RebindInputActions();
+	}
+}
+
+bool UEasyEIBindingsComponent::StartInputReplay(const FString& Filename)
+{
+	StopInputReplay();
+
+	InputPlayer = FEasyEIInputPlayer::Open(Filename);
+	if (!InputPlayer)
+	{
+		return false;
+	}
+
+	ReplayFrameOffset = 0;
+	if (BoundInputComponent.IsValid())
+	{
+		RebindInputActions();
+	}
+	UpdateDispatchTick();
+
+	UE_LOG(LogEasyEIBindings, Log, TEXT("%hs: Replaying %s into %s."), __FUNCTION__, *Filename, *GetNameSafe(GetOwner()));
+	return true;
+}
+
+void UEasyEIBindingsComponent::StopInputReplay()
+{
+	if (!InputPlayer)
+	{
+		return;
+	}
+
+	InputPlayer.Reset();
+	if (BoundInputComponent.IsValid())
+	{
+		RebindInputActions();
+	}
+	UpdateDispatchTick();
+}
+
+void UEasyEIBindingsComponent::AdvanceInputReplay()
+{
+	if (!InputPlayer)
+	{
+		return;
+	}
+
+	// Paced by frames rather than time, so a replay runs the same however fast the frames are
+	const bool bMoreEvents = InputPlayer->Advance(ReplayFrameOffset++, [this](const FEasyEIRecordedEvent& Event)
+	{
+		// Recorded events already passed coalescing and throttling, so they go straight to the handler
+		const int32* SlotIndex = DispatchSlotIndices.Find(Event.Action);
+		if (SlotIndex && DispatchSlots[*SlotIndex].Handlers[Event.EventIndex])
+		{
+			DeliverToHandler(DispatchSlots[*SlotIndex], Event.EventIndex, Event.Value, 0.f, 0.f);
+		}
+		else if (!BoundInputComponent.IsValid())
+		{
+			// Headless owners without an input component were never set up, call the handler directly
+			InvokeUnboundHandler(Event.Action, Event.EventIndex, Event.Value);
+		}
+	});
+
+	if (!bMoreEvents)
+	{
+		UE_LOG(LogEasyEIBindings, Log, TEXT("%hs: Replay finished for %s."), __FUNCTION__, *GetNameSafe(GetOwner()));
+		StopInputReplay();
+	}
+}
+
+FEasyEIForwardingStats UEasyEIBindingsComponent::GetForwardingStats() const
+{
+	FEasyEIForwardingStats Stats = ForwardingStats;
+	Stats.BytesSent = FMath::DivideAndRoundUp<int64>(ForwardedBitsSent, 8);
+	Stats.BytesReceived = FMath::DivideAndRoundUp<int64>(ForwardedBitsReceived, 8);
+	return Stats;
+}
+
+void UEasyEIBindingsComponent::ResetForwardingStats()
+{
+	ForwardingStats = FEasyEIForwardingStats();
+	ForwardedBitsSent = 0;
+	ForwardedBitsReceived = 0;
+}
+
+void UEasyEIBindingsComponent::DumpForwardingStats(FOutputDevice& Ar) const
+{
+	const FEasyEIForwardingStats Stats = GetForwardingStats();
+	Ar.Logf(TEXT("Forwarding for %s (%s): sent %d packet(s), %d event(s), %lld bytes; received %d packet(s), %d event(s), %lld bytes, %d event(s) and %d packet(s) rejected"),
+	        *GetPathNameSafe(this), GetOwner() && GetOwner()->HasAuthority() ? TEXT("server") : TEXT("client"),
+	        Stats.PacketsSent, Stats.EventsSent, Stats.BytesSent, Stats.PacketsReceived, Stats.EventsReceived,
+	        Stats.BytesReceived, Stats.EventsRejected, Stats.PacketsRejected);
+}
+
+void UEasyEIBindingsComponent::UpdateDispatchTick()
+{
+	// Coalesced values and merged over-rate events are delivered, forwarded input sent and queued
+	// mapping context changes applied from the tick
+	const bool bNeedsTick = bForwardToServer || InputPlayer || bMappingContextsDirty || DispatchSlots.ContainsByPredicate([](const FEasyEIDispatchSlot& Slot)
+	{
+		if (Slot.Coalescing != EEasyEIValueCoalescing::None)
+		{
+			return true;
+		}
+
+		for (const FEasyEIThrottleState& Throttle : Slot.Throttles)
+		{
+			if (Throttle.MinInterval > 0.f && Throttle.Mode == EEasyEIThrottleMode::Merge)
+			{
+				return true;
+			}
+		}
+		return false;
+	});
+
+	if (IsComponentTickEnabled() != bNeedsTick)
+	{
+		SetComponentTickEnabled(bNeedsTick);
+	}
+}
+
+void UEasyEIBindingsComponent::RecordInputLatency(FEasyEIDispatchSlot& Slot)
+{
+	const FEasyEIInputTimestamper* Timestamper = FEasyEIBindingsModule::Get().GetInputTimestamper();
+	if (!Timestamper)
+	{
+		return;
+	}
+
+	if (!Slot.bLatencyKeysResolved)
+	{
+		Slot.bLatencyKeysResolved = true;
+
+		const UEnhancedInputLocalPlayerSubsystem* Subsystem = GetEnhancedInputSubsystem();
+		const UEnhancedPlayerInput* PlayerInput = Subsystem ? Subsystem->GetPlayerInput() : nullptr;
+		if (PlayerInput)
+		{
+			for (const FEnhancedActionKeyMapping& Mapping : PlayerInput->GetEnhancedActionMappings())
+			{
+				if (Mapping.Action == Slot.Action)
+				{
+					Slot.LatencyKeys.AddUnique(Mapping.Key);
+				}
+			}
+		}
+	}
+
+	const FEasyEIInputStamp* Newest = nullptr;
+	for (const FKey& Key : Slot.LatencyKeys)
+	{
+		const FEasyEIInputStamp* Stamp = Timestamper->FindStamp(Key);
+		if (Stamp && Stamp->Cycles > Slot.LastMeasuredInputCycles && (!Newest || Stamp->Cycles > Newest->Cycles))
+		{
+			Newest = Stamp;
+		}
+	}
+
+	if (!Newest)
+	{
+		return;
+	}
+
+	Slot.LastMeasuredInputCycles = Newest->Cycles;
+
+	const double Microseconds = FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - Newest->Cycles) * 1000000.0;
+	LatencyHistograms.FindOrAdd(Slot.Action).AddSample(Microseconds, GFrameCounter - Newest->Frame);
+}
+
+FEasyEILatencyStats UEasyEIBindingsComponent::GetInputLatencyStats(const UInputAction* Action) const
+{
+	const FEasyEILatencyHistogram* Histogram = LatencyHistograms.Find(Action);
+	return Histogram ? Histogram->GetStats() : FEasyEILatencyStats();
+}
+
+void UEasyEIBindingsComponent::ResetInputLatencyStats()
+{
+	LatencyHistograms.Reset();
+}
+
+void UEasyEIBindingsComponent::DumpInputLatency(FOutputDevice& Ar) const
+{
+	Ar.Logf(TEXT("Input latency for %s (%d action(s)):"), *GetPathNameSafe(this), LatencyHistograms.Num());
+	for (const TPair<TObjectKey<UInputAction>, FEasyEILatencyHistogram>& Pair : LatencyHistograms)
+	{
+		const FEasyEILatencyStats Stats = Pair.Value.GetStats();
+		Ar.Logf(TEXT("  %-32s %6d samples  p50 %8.0f us / %2d fr  p95 %8.0f us / %2d fr  p99 %8.0f us / %2d fr"),
+		        *GetNameSafe(Pair.Key.ResolveObjectPtr()), Stats.SampleCount,
+		        Stats.P50Microseconds, Stats.P50Frames, Stats.P95Microseconds, Stats.P95Frames,
+		        Stats.P99Microseconds, Stats.P99Frames);
+	}
+}
+
+bool UEasyEIBindingsComponent::AcquireInputActions()
+{
+	if (BindingSet && !BindingSetLoadHandle.IsValid())
+	{
+		BindingSetLoadHandle = BindingSet->RequestPreload();
+	}
+
+	TArray<FSoftObjectPath> Paths;
+	auto AddSoftAction = [&Paths](const FEasyEIBinding& Binding)
+	{
+		if (!Binding.InputAction && !Binding.SoftInputAction.IsNull())
+		{
+			Paths.AddUnique(Binding.SoftInputAction.ToSoftObjectPath());
+		}
+	};
+
+	for (const FEasyEIBinding& Binding : InputBindings)
+	{
+		AddSoftAction(Binding);
+	}
+	for (const FEasyEINamedBindingSet& NamedSet : NamedBindingSets)
+	{
+		for (const FEasyEIBinding& Binding : NamedSet.Bindings)
+		{
+			AddSoftAction(Binding);
+		}
+	}
+
+	if (Paths != InputBindingsLoadPaths)
+	{
+		// Request the new handle before dropping the old one, so actions in both stay loaded
+		TSharedPtr<FStreamableHandle> PreviousHandle = MoveTemp(InputBindingsLoadHandle);
+		InputBindingsLoadPaths = Paths;
+		if (!Paths.IsEmpty())
+		{
+			InputBindingsLoadHandle = UAssetManager::GetStreamableManager().RequestAsyncLoad(
+				MoveTemp(Paths), FStreamableDelegate::CreateUObject(this, &UEasyEIBindingsComponent::HandleInputActionsLoaded));
+		}
+	}
+
+	if (HaveInputActionsLoaded())
+	{
+		StopWaitingForInputActions();
+		return true;
+	}
+
+	if (!bWaitingForInputActions)
+	{
+		bWaitingForInputActions = true;
+		if (BindingSet && BindingSetLoadHandle.IsValid() && !BindingSetLoadHandle->HasLoadCompleted())
+		{
+			BindingSet->OnPreloadComplete().AddUObject(this, &UEasyEIBindingsComponent::HandleInputActionsLoaded);
+		}
+	}
+	return false;
+}
+
+bool UEasyEIBindingsComponent::HaveInputActionsLoaded() const
+{
+	return (!BindingSetLoadHandle.IsValid() || BindingSetLoadHandle->HasLoadCompleted())
+		&& (!InputBindingsLoadHandle.IsValid() || InputBindingsLoadHandle->HasLoadCompleted());
+}
+
+void UEasyEIBindingsComponent::HandleInputActionsLoaded()
+{
+	if (!bWaitingForInputActions || !HaveInputActionsLoaded())
+	{
+		return;
+	}
+
+	StopWaitingForInputActions();
+
+	if (BoundInputComponent.IsValid())
+	{
+		RebindInputActions();
+	}
+	else
+	{
+		SetupInputActions(PendingInputComponent.Get());
+	}
+}
+
+void UEasyEIBindingsComponent::StopWaitingForInputActions()
+{
+	if (bWaitingForInputActions && BindingSet)
+	{
+		BindingSet->OnPreloadComplete().RemoveAll(this);
+	}
+	bWaitingForInputActions = false;
+}
+
+void UEasyEIBindingsComponent::ReleaseInputActions()
+{
+	StopWaitingForInputActions();
+	PendingInputComponent = nullptr;
+	BindingSetLoadHandle.Reset();
+	InputBindingsLoadHandle.Reset();
+	InputBindingsLoadPaths.Reset();
+}
+
+int32 UEasyEIBindingsComponent::GetThrottledEventCount(const UInputAction* Action) const
+{
+	const int32* Count = ThrottledEventCounts.Find(Action);
+	return Count ? *Count : 0;
+}
+
+void UEasyEIBindingsComponent::ResetThrottledEventCounts()
+{
+	ThrottledEventCounts.Reset();
+}
+
+void UEasyEIBindingsComponent::DumpThrottledEvents(FOutputDevice& Ar) const
+{
+	if (ThrottledEventCounts.IsEmpty())
+	{
+		return;
+	}
+
+	Ar.Logf(TEXT("Throttled events for %s (%d action(s)):"), *GetPathNameSafe(this), ThrottledEventCounts.Num());
+	for (const TPair<TObjectKey<UInputAction>, int32>& Pair : ThrottledEventCounts)
+	{
+		Ar.Logf(TEXT("  %-32s %8d"), *GetNameSafe(Pair.Key.ResolveObjectPtr()), Pair.Value);
+	}
+}
+
+UEnhancedInputLocalPlayerSubsystem* UEasyEIBindingsComponent::GetEnhancedInputSubsystem() const
+{
+	const APlayerController* PlayerController = Cast<APlayerController>(GetOwner());
+	if (!PlayerController)
+	{
+		const APawn* Pawn = Cast<APawn>(GetOwner());
+		PlayerController = Pawn ? Pawn->GetController<APlayerController>() : nullptr;
+	}
+
+	const ULocalPlayer* LocalPlayer = PlayerController ? PlayerController->GetLocalPlayer() : nullptr;
+	return ULocalPlayer::GetSubsystem<UEnhancedInputLocalPlayerSubsystem>(LocalPlayer);
+}
+
+bool UEasyEIBindingsComponent::ShouldWatchMappingContexts() const
+{
+	return bBindMappedActionsOnly || bMeasureInputLatency;
+}
+
+void UEasyEIBindingsComponent::WatchMappingContexts()
+{
+	UEnhancedInputLocalPlayerSubsystem* Subsystem = GetEnhancedInputSubsystem();
+	if (Subsystem != WatchedInputSubsystem.Get())
+	{
+		StopWatchingMappingContexts();
+	}
+
+	if (!Subsystem)
+	{
+		// Without a local player there is nothing to follow, so every action is bound
+		UE_LOG(LogEasyEIBindings, Verbose, TEXT("%hs: %s has no local player, binding all actions."),
+		       __FUNCTION__, *GetNameSafe(GetOwner()));
+		return;
+	}
+
+	WatchedInputSubsystem = Subsystem;
+	Subsystem->ControlMappingsRebuiltDelegate.AddUniqueDynamic(this, &UEasyEIBindingsComponent::HandleControlMappingsRebuilt);
+	RefreshMappedActions();
+}
+
+void UEasyEIBindingsComponent::StopWatchingMappingContexts()
+{
+	if (UEnhancedInputLocalPlayerSubsystem* Subsystem = WatchedInputSubsystem.Get())
+	{
+		Subsystem->ControlMappingsRebuiltDelegate.RemoveDynamic(this, &UEasyEIBindingsComponent::HandleControlMappingsRebuilt);
+	}
+	WatchedInputSubsystem = nullptr;
+	MappedActions.Empty();
+}
+
+void UEasyEIBindingsComponent::RefreshMappedActions()
+{
+	MappedActions.Reset();
+
+	const UEnhancedInputLocalPlayerSubsystem* Subsystem = WatchedInputSubsystem.Get();
+	const UEnhancedPlayerInput* PlayerInput = Subsystem ? Subsystem->GetPlayerInput() : nullptr;
+	if (!PlayerInput)
+	{
+		return;
+	}
+
+	for (const FEnhancedActionKeyMapping& Mapping : PlayerInput->GetEnhancedActionMappings())
+	{
+		MappedActions.Add(Mapping.Action);
+	}
+}
+
+bool UEasyEIBindingsComponent::IsActionMapped(const UInputAction* Action) const
+{
+	return !bBindMappedActionsOnly || !WatchedInputSubsystem.IsValid() || MappedActions.Contains(Action);
+}
+
+void UEasyEIBindingsComponent::HandleControlMappingsRebuilt()
+{
+	// Remapped keys are looked up again on the next measured event
+	for (FEasyEIDispatchSlot& Slot : DispatchSlots)
+	{
+		Slot.LatencyKeys.Reset();
+		Slot.bLatencyKeysResolved = false;
+	}
+
+	if (bBindMappedActionsOnly)
+	{
+		RefreshMappedActions();
+
+		// Diffs against the bound set, so only actions whose context was added or removed are touched
+		RebindInputActions();
+	}
+}
+
+void UEasyEIBindingsComponent::HandleControllerChanged(APawn* Pawn, AController* OldController, AController* NewController)
+{
+	if (!IsPossessedByLocalPlayer())
+	{
+		// Released right away, the pawn may be pooled or possessed by AI before the next tick
+		EnterDormancy();
+		return;
+	}
+
+	// The pawn creates its input component after the controller change is broadcast, usually from the restart
+	// that HandlePawnRestarted follows. The tick is a fallback for owners that are not restarted.
+	PossessionRetries = 0;
+	SchedulePossessionUpdate();
+}
+
+void UEasyEIBindingsComponent::HandlePawnRestarted(APawn* Pawn)
+{
+	UpdatePossession();
+}
+
+void UEasyEIBindingsComponent::SchedulePossessionUpdate()
+{
+	UWorld* World = GetWorld();
+	if (World && !PossessionUpdateTimer.IsValid())
+	{
+		PossessionUpdateTimer = World->GetTimerManager().SetTimerForNextTick(
+			FTimerDelegate::CreateUObject(this, &UEasyEIBindingsComponent::UpdatePossession));
+	}
+}
+
+void UEasyEIBindingsComponent::CancelPossessionUpdate()
+{
+	if (UWorld* World = GetWorld())
+	{
+		World->GetTimerManager().ClearTimer(PossessionUpdateTimer);
+	}
+	PossessionUpdateTimer.Invalidate();
+}
+
+bool UEasyEIBindingsComponent::IsPossessedByLocalPlayer() const
+{
+	const APawn* Pawn = Cast<APawn>(GetOwner());
+	const APlayerController* PlayerController = Pawn ? Pawn->GetController<APlayerController>() : nullptr;
+	return PlayerController && PlayerController->IsLocalController();
+}
+
+void UEasyEIBindingsComponent::UpdatePossession()
+{
+	// Also reached from HandlePawnRestarted, which makes a pending tick redundant
+	CancelPossessionUpdate();
+	if (!HasBegunPlay())
+	{
+		return;
+	}
+
+	if (!IsPossessedByLocalPlayer())
+	{
+		EnterDormancy();
+		return;
+	}
+
+	const AActor* Owner = GetOwner();
+	if (BoundInputComponent.IsValid() && BoundInputComponent.Get() == Owner->InputComponent)
+	{
+		return;
+	}
+
+	// On clients the restart RPC can arrive after the controller replicated. Past the retries, HandlePawnRestarted binds.
+	if (!Owner->InputComponent)
+	{
+		if (++PossessionRetries <= MaxPossessionRetries)
+		{
+			SchedulePossessionUpdate();
+		}
+		return;
+	}
+
+	// Handed to another local player within a frame, the old input component is gone
+	EnterDormancy();
+	SetupInputActions();
+}
+
+void UEasyEIBindingsComponent::EnterDormancy()
+{
+	CancelPossessionUpdate();
+	if (!BoundInputComponent.IsValid() && !PendingInputComponent.IsValid())
+	{
+		return;
+	}
+
+	if (UEnhancedInputComponent* EnhancedInputComponent = BoundInputComponent.Get())
+	{
+		for (const TPair<FEasyEIBindingKey, FEasyEIBoundEvent>& Pair : BoundEvents)
+		{
+			EnhancedInputComponent->RemoveBindingByHandle(Pair.Value.Handle);
+		}
+	}
+
+	// Only events that were bound are kept, a setup still waiting for loads gathers from scratch
+	if (BoundInputComponent.IsValid())
+	{
+		DormantEvents = MoveTemp(BoundEvents);
+		for (TPair<FEasyEIBindingKey, FEasyEIBoundEvent>& Pair : DormantEvents)
+		{
+			Pair.Value.Handle = 0;
+		}
+		DormantSignature = GetBindingsSignature();
+		DormantCacheGeneration = FEasyEIBindingsModule::Get().GetBindingCache().GetGeneration();
+	}
+	BoundEvents.Reset();
+
+	// Soft action loads stay held, so re-possession does not wait for them again
+	ClearInputBindings();
+}
+
+bool UEasyEIBindingsComponent::TakeDormantEvents()
+{
+	if (DormantEvents.IsEmpty())
+	{
+		return false;
+	}
+
+	TMap<FEasyEIBindingKey, FEasyEIBoundEvent> Events = MoveTemp(DormantEvents);
+	DormantEvents.Reset();
+
+	// Mapped-only bindings follow the new player's contexts. Edits, recompiles and reloads while dormant regather.
+	if ((bBindMappedActionsOnly && WatchedInputSubsystem.IsValid()) || DormantSignature != GetBindingsSignature()
+		|| DormantCacheGeneration != FEasyEIBindingsModule::Get().GetBindingCache().GetGeneration())
+	{
+		return false;
+	}
+
+	BoundEvents = MoveTemp(Events);
+	return true;
+}
+
+uint32 UEasyEIBindingsComponent::GetBindingsSignature() const
+{
+	uint32 Hash = GetTypeHash(BindingSet.Get());
+	Hash = HashCombine(Hash, UsesComponentDispatch() ? 1u : 0u);
+
+	auto HashBinding = [&Hash](const FEasyEIBinding& Binding)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(Binding.GetInputAction()));
+		Hash = HashCombine(Hash, GetTypeHash(Binding.EnabledEvents));
+		Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Binding.TriggeredCoalescing)));
+		Hash = HashCombine(Hash, GetTypeHash(Binding.CoalesceEpsilon));
+		Hash = HashCombine(Hash, GetTypeHash(Binding.MaxDispatchRate));
+		Hash = HashCombine(Hash, GetTypeHash(static_cast<uint8>(Binding.ThrottleMode)));
+	};
+
+	for (const FEasyEIBinding& Binding : InputBindings)
+	{
+		HashBinding(Binding);
+	}
+
+	for (const FEasyEINamedBindingSet& NamedSet : NamedBindingSets)
+	{
+		Hash = HashCombine(Hash, GetTypeHash(NamedSet.Bindings.Num()));
+		for (const FEasyEIBinding& Binding : NamedSet.Bindings)
+		{
+			HashBinding(Binding);
+		}
+	}
+
+	// Order independent, registration order does not change the gathered events
+	uint32 NativeHash = 0;
+	for (const TPair<FEasyEIBindingKey, FEasyEINativeHandler>& Pair : NativeHandlers)
+	{
+		NativeHash ^= GetTypeHash(Pair.Key);
+	}
+	return HashCombine(Hash, NativeHash);
+}
+
+void UEasyEIBindingsComponent::RemoveNativeHandler(const UInputAction* Action, ETriggerEvent Event)
+{
+	const FEasyEIBindingKey Key(Action, Event);
+	if (NativeHandlers.Remove(Key) > 0 && BoundInputComponent.IsValid())
+	{
+		UnbindEvent(Key);
+		RebindInputActions();
+	}
+}
+
+void UEasyEIBindingsComponent::RemoveNativeHandlers(const UObject* Object)
+{
+	const int32 NumBefore = NativeHandlers.Num();
+	for (auto It = NativeHandlers.CreateIterator(); It; ++It)
+	{
+		if (It.Value().Object == Object)
+		{
+			UnbindEvent(It.Key());
+			It.RemoveCurrent();
+		}
+	}
+
+	if (NativeHandlers.Num() != NumBefore && BoundInputComponent.IsValid())
+	{
+		RebindInputActions();
+	}
+}
+
+void UEasyEIBindingsComponent::RegisterNativeHandler(const UInputAction* Action, ETriggerEvent Event,
+                                                     FEasyEINativeHandler&& Handler)
+{
+	if (!Action || !Handler.Object.IsValid())
+	{
+		UE_LOG(LogEasyEIBindings, Warning, TEXT("%hs: Native handler needs a valid action and object."), __FUNCTION__);
+		return;
+	}
+
+	const FEasyEIBindingKey Key(Action, Event);
+	NativeHandlers.Add(Key, MoveTemp(Handler));
+
+	// Handlers registered after setup take effect immediately
+	if (BoundInputComponent.IsValid())
+	{
+		UnbindEvent(Key);
+		RebindInputActions();
+	}
+}
+
+const FEasyEINativeHandler* UEasyEIBindingsComponent::FindNativeHandler(const UInputAction* Action,
+                                                                        ETriggerEvent Event) const
+{
+	if (NativeHandlers.IsEmpty())
+	{
+		return nullptr;
+	}
+
+	const FEasyEINativeHandler* Handler = NativeHandlers.Find(FEasyEIBindingKey(Action, Event));
+	return Handler && Handler->Object.IsValid() ? Handler : nullptr;
+}
+
+void UEasyEIBindingsComponent::RebindInputActions()
+{
+	SCOPE_CYCLE_COUNTER(STAT_EasyEIBindings_RebindInputActions);
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(EasyEIBindings_RebindInputActions, EasyEIBindingsChannel);
+
+	AActor* Owner = GetOwner();
+	UEnhancedInputComponent* EnhancedInputComponent = BoundInputComponent.Get();
+	if (!Owner || !EnhancedInputComponent)
+	{
+		ClearInputBindings();
+		SetupInputActions(EnhancedInputComponent);
+		return;
+	}
+
+	if (!AcquireInputActions())
+	{
+		// Rebinds from HandleInputActionsLoaded
+		return;
+	}
+
+	// Bindings may have changed, the server rebuilds its table the same way when it rebinds
+	if (bForwardToServer)
+	{
+		FlushForwardedInput();
+		BuildForwardedActions();
+	}
+
+	if (ShouldWatchMappingContexts() && !WatchedInputSubsystem.IsValid())
+	{
+		WatchMappingContexts();
+	}
+	else if (!ShouldWatchMappingContexts() && WatchedInputSubsystem.IsValid())
+	{
+		StopWatchingMappingContexts();
+	}
+
+	// Only touch the events that changed, unchanged bindings keep their handles
+	TMap<FEasyEIBindingKey, FEasyEIBoundEvent> DesiredEvents;
+	GatherDesiredEvents(Owner, DesiredEvents);
+
+	for (auto It = BoundEvents.CreateIterator(); It; ++It)
+	{
+		const FEasyEIBoundEvent* Desired = DesiredEvents.Find(It.Key());
+		if (Desired && Desired->HasSameTarget(It.Value()))
+		{
+			DesiredEvents.Remove(It.Key());
+			continue;
+		}
+
+		ReleaseEvent(EnhancedInputComponent, It.Key(), It.Value());
+		It.RemoveCurrent();
+	}
+
+	for (TPair<FEasyEIBindingKey, FEasyEIBoundEvent>& Pair : DesiredEvents)
+	{
+		if (BindEvent(*EnhancedInputComponent, Owner, Pair.Key, Pair.Value))
+		{
+			BoundEvents.Add(Pair.Key, Pair.Value);
+		}
+	}
+
+	UpdateDispatchTick();
+}
+
+void UEasyEIBindingsComponent::ClearInputBindings()
+{
+	SCOPE_CYCLE_COUNTER(STAT_EasyEIBindings_ClearInputBindings);
+	TRACE_CPUPROFILER_EVENT_SCOPE_ON_CHANNEL(EasyEIBindings_ClearInputBindings, EasyEIBindingsChannel);
+
+	// Unsubscribed even without an owner, a remap would otherwise rebind a cleared or ended component
+	StopWatchingMappingContexts();
+
+	AActor* Owner = GetOwner();
+	if (!Owner)
+	{
+		return;
+	}
+
+	UEnhancedInputComponent* EnhancedInputComponent = BoundInputComponent.IsValid()
+		                                                  ? BoundInputComponent.Get()
+		                                                  : Cast<UEnhancedInputComponent>(Owner->InputComponent);
+	BoundInputComponent = nullptr;
+	PendingInputComponent = nullptr;
+	StopWaitingForInputActions();
+
+	if (EnhancedInputComponent)
+	{
+		for (const TPair<FEasyEIBindingKey, FEasyEIBoundEvent>& Pair : BoundEvents)
+		{
+			EnhancedInputComponent->RemoveBindingByHandle(Pair.Value.Handle);
+		}
+	}
+	BoundEvents.Empty();
+	DispatchSlots.Empty();
+	DispatchSlotIndices.Empty();
+
+	// Removed from the next tick, a setup in the same frame keeps them without a rebuild
+	if (!AppliedMappingContexts.IsEmpty())
+	{
+		bMappingContextsDirty = true;
+	}
+	UpdateDispatchTick();
+}
+
+#if WITH_EDITOR
+void UEasyEIBindingsComponent::PreSave(FObjectPreSaveContext SaveContext)
+{
+	Super::PreSave(SaveContext);
+
+	BakedBindings.Reset();
+	BakedOwnerClass = nullptr;
+
+	if (bBakeBindingTable)
+	{
+		BakeBindingTable();
+	}
+}
+
+UClass* UEasyEIBindingsComponent::GetOuterOwnerClass() const
+{
+	// Component templates live inside their Blueprint class, placed components inside their actor
+	UClass* OwnerClass = GetTypedOuter<UBlueprintGeneratedClass>();
+	if (!OwnerClass)
+	{
+		const AActor* OuterActor = GetTypedOuter<AActor>();
+		OwnerClass = OuterActor ? OuterActor->GetClass() : nullptr;
+	}
+	return OwnerClass;
+}
+
+void UEasyEIBindingsComponent::AppendBindingTagEntries(TArray<FString>& OutEntries, const UClass* OwnerClass) const
+{
+	if (!OwnerClass)
+	{
+		OwnerClass = GetOuterOwnerClass();
+	}
+	if (!OwnerClass)
+	{
+		return;
+	}
+
+	TSet<FSoftObjectPath> ListedActions;
+	auto AddEntry = [&OutEntries, &ListedActions, OwnerClass](const FEasyEIBinding& Binding)
+	{
+		const FSoftObjectPath ActionPath = Binding.InputAction
+			                                   ? FSoftObjectPath(Binding.InputAction.Get())
+			                                   : Binding.SoftInputAction.ToSoftObjectPath();
+		if (ActionPath.IsNull())
+		{
+			return;
+		}
+
+		bool bAlreadyListed = false;
+		ListedActions.Add(ActionPath, &bAlreadyListed);
+		if (bAlreadyListed)
+		{
+			return;
+		}
+
+		FEasyEIBindingTagEntry Entry;
+		Entry.OwnerClassPath = OwnerClass->GetPathName();
+		Entry.ActionPath = ActionPath.ToString();
+		Entry.EnabledEventSlots = Binding.GetEnabledEventSlots();
+		for (int32 EventIndex = 0; EventIndex < EasyEIBindings::NumTriggerEvents; ++EventIndex)
+		{
+			if (Entry.EnabledEventSlots & (1 << EventIndex))
+			{
+				Entry.HandlerNames.Add(EasyEIBindings::MakeHandlerName(ActionPath.GetAssetName(), EventIndex));
+			}
+		}
+		OutEntries.Add(Entry.ToString());
+	};
+
+	// InputBindings come first so they replace BindingSet entries for the same action
+	for (const FEasyEIBinding& Binding : InputBindings)
+	{
+		AddEntry(Binding);
+	}
+	if (BindingSet)
+	{
+		for (const FEasyEIBinding& Binding : BindingSet->Bindings)
+		{
+			AddEntry(Binding);
+		}
+	}
+	for (const FEasyEINamedBindingSet& NamedSet : NamedBindingSets)
+	{
+		for (const FEasyEIBinding& Binding : NamedSet.Bindings)
+		{
+			AddEntry(Binding);
+		}
+	}
+}
+
+void UEasyEIBindingsComponent::BakeBindingTable()
+{
+	UClass* OwnerClass = GetOuterOwnerClass();
+	if (!OwnerClass)
+	{
+		return;
+	}
+
+	BakedOwnerClass = OwnerClass;
+	BakedBindings.Reserve(InputBindings.Num());
+
+	for (const FEasyEIBinding& Binding : InputBindings)
+	{
+		FEasyEIBakedBinding& Baked = BakedBindings.AddDefaulted_GetRef();
+		Baked.InputAction = Binding.InputAction;
+		Baked.SoftInputAction = Binding.SoftInputAction;
+		Baked.EnabledEvents = Binding.EnabledEvents;
+
+		const UInputAction* Action = Binding.InputAction ? Binding.InputAction.Get() : Binding.SoftInputAction.LoadSynchronous();
+		const FEasyEIResolvedAction Resolved = FEasyEIBindingsCache::Resolve(OwnerClass, Action);
+		for (int32 EventIndex = 0; EventIndex < EasyEIBindings::NumTriggerEvents; ++EventIndex)
+		{
+			if (Binding.IsEventEnabled(EasyEIBindings::GetTriggerEvent(EventIndex)) && Resolved.Handlers[EventIndex])
+			{
+				Baked.HandlerNames[EventIndex] = Resolved.HandlerNames[EventIndex];
+			}
+		}
+	}
+}
+#endif
+
+const FEasyEIBakedBinding* UEasyEIBindingsComponent::FindBakedBinding(int32 BindingIndex, const UClass* OwnerClass) const
+{
+	if (!bBakeBindingTable || BakedOwnerClass != OwnerClass || !BakedBindings.IsValidIndex(BindingIndex))
+	{
+		return nullptr;
+	}
+
+	// Bindings edited after the last save fall back to runtime resolution
+	const FEasyEIBakedBinding& Baked = BakedBindings[BindingIndex];
+	const FEasyEIBinding& Binding = InputBindings[BindingIndex];
+	if (Baked.InputAction != Binding.InputAction || Baked.SoftInputAction != Binding.SoftInputAction
+		|| Baked.EnabledEvents != Binding.EnabledEvents)
+	{
+		return nullptr;
+	}
+
+	return &Baked;
+}
+
+void UEasyEIBindingsComponent::BeginPlay()
+{
+	Super::BeginPlay();
+
+	// Headless replays, e.g. -EasyEIBindingsReplay=Session1 with -nullrhi
+	FString ReplayName;
+	if (FParse::Value(FCommandLine::Get(), TEXT("EasyEIBindingsReplay="), ReplayName))
+	{
+		const FString Filename = GetRecordingFilename(ReplayName, this);
+		if (IFileManager::Get().FileExists(*Filename))
+		{
+			StartInputReplay(Filename);
+		}
+	}
+
+	// Dormant until possessed, nothing is gathered or allocated for AI controlled pawns
+	if (bBindOnPossession)
+	{
+		if (APawn* Pawn = Cast<APawn>(GetOwner()))
+		{
+			Pawn->ReceiveControllerChangedDelegate.AddUniqueDynamic(this, &UEasyEIBindingsComponent::HandleControllerChanged);
+			Pawn->ReceiveRestartedDelegate.AddUniqueDynamic(this, &UEasyEIBindingsComponent::HandlePawnRestarted);
+			if (IsPossessedByLocalPlayer())
+			{
+				HandleControllerChanged(Pawn, nullptr, Pawn->GetController());
+			}
+			return;
+		}
+
+		UE_LOG(LogEasyEIBindings, Verbose, TEXT("%hs: %s is not a pawn, bBindOnPossession is ignored."),
+		       __FUNCTION__, *GetNameSafe(GetOwner()));
+	}
+
+	const UEasyEIBindingsRuntimeSettings* Settings = UEasyEIBindingsRuntimeSettings::Get();
+	UWorld* World = GetWorld();
+	UEasyEIBindingsSetupSubsystem* SetupSubsystem = World ? World->GetSubsystem<UEasyEIBindingsSetupSubsystem>() : nullptr;
+	if (Settings && Settings->bTimeSliceSetup && SetupSubsystem)
+	{
+		SetupSubsystem->EnqueueSetup(this);
+		return;
+	}
+
+	SetupInputActions();
+}
+
+void UEasyEIBindingsComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	// Dropped without rebinding, the recorder writes its last chunk as it closes
+	InputRecorder.Reset();
+	InputPlayer.Reset();
+
+	// The input component can outlive this component, e.g. when it belongs to the controller
+	ClearInputBindings();
+	StopWatchingMappingContexts();
+	ReleaseInputActions();
+
+	// No tick follows, so the contexts are removed right away
+	ReleaseMappingContexts();
+	bMappingContextsDirty = false;
+
+	if (APawn* Pawn = Cast<APawn>(GetOwner()))
+	{
+		Pawn->ReceiveControllerChangedDelegate.RemoveDynamic(this, &UEasyEIBindingsComponent::HandleControllerChanged);
+		Pawn->ReceiveRestartedDelegate.RemoveDynamic(this, &UEasyEIBindingsComponent::HandlePawnRestarted);
+	}
+	CancelPossessionUpdate();
+	DormantEvents.Empty();
+
+	Super::EndPlay(EndPlayReason);
 }
@@ -13,6 +13,7 @@ UEasyEIBindingsDeveloperSettings::UEasyEIBindingsDeveloperSettings()
 
 	bGenerateBlueprintEvents = false;
 	bShowBindingStatus = true;
+	BindingTableThreshold = 32;
 }
 
 const UEasyEIBindingsDeveloperSettings* UEasyEIBindingsDeveloperSettings::Get()
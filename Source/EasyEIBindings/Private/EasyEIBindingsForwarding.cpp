@@ -0,0 +1,94 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+
+#include "EasyEIBindingsForwarding.h"
+
+#include "EasyEIBindingsCache.h"
+#include "Serialization/BitWriter.h"
+
+
+namespace EasyEIBindingsForwarding
+{
+	static void SerializeQuantizedAxis(FArchive& Ar, double& Value)
+	{
+		constexpr double MaxQuantized = MAX_int32 / 2;
+		const int32 Quantized = static_cast<int32>(FMath::Clamp(FMath::RoundToDouble(Value / FEasyEIForwardedInput::ValueResolution),
+		                                                        -MaxQuantized, MaxQuantized));
+
+		// Zigzag encoding keeps small negative values small when packed
+		uint32 Encoded = (static_cast<uint32>(Quantized) << 1) ^ static_cast<uint32>(Quantized >> 31);
+		Ar.SerializeIntPacked(Encoded);
+
+		if (Ar.IsLoading())
+		{
+			const int32 Decoded = static_cast<int32>(Encoded >> 1) ^ -static_cast<int32>(Encoded & 1);
+			Value = Decoded * static_cast<double>(FEasyEIForwardedInput::ValueResolution);
+		}
+	}
+}
+
+bool FEasyEIForwardedInput::NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess)
+{
+	Ar << TableHash;
+
+	uint32 NumEvents = Events.Num();
+	Ar.SerializeIntPacked(NumEvents);
+
+	if (Ar.IsLoading())
+	{
+		if (NumEvents > MaxEvents)
+		{
+			Ar.SetError();
+			bOutSuccess = false;
+			return false;
+		}
+		Events.SetNum(NumEvents);
+	}
+
+	for (FEasyEIForwardedEvent& Event : Events)
+	{
+		uint32 ActionIndex = Event.ActionIndex;
+		Ar.SerializeIntPacked(ActionIndex);
+
+		uint32 EventIndex = Event.EventIndex;
+		Ar.SerializeInt(EventIndex, EasyEIBindings::NumTriggerEvents);
+
+		// Sent with the event so the server can read packets for actions it has not loaded
+		uint32 ValueType = static_cast<uint32>(Event.Value.GetValueType());
+		Ar.SerializeInt(ValueType, static_cast<uint32>(EInputActionValueType::Axis3D) + 1);
+
+		FVector Axes = Event.Value.Get<FVector>();
+		if (static_cast<EInputActionValueType>(ValueType) == EInputActionValueType::Boolean)
+		{
+			uint8 bPressed = Axes.X != 0.0 ? 1 : 0;
+			Ar.SerializeBits(&bPressed, 1);
+			Axes = FVector(bPressed ? 1.0 : 0.0, 0.0, 0.0);
+		}
+		else
+		{
+			// Axis1D, Axis2D and Axis3D carry one, two and three components
+			for (uint32 Axis = 0; Axis < ValueType; ++Axis)
+			{
+				EasyEIBindingsForwarding::SerializeQuantizedAxis(Ar, Axes[Axis]);
+			}
+		}
+
+		if (Ar.IsLoading())
+		{
+			Event.ActionIndex = static_cast<uint16>(FMath::Min<uint32>(ActionIndex, MAX_uint16));
+			Event.EventIndex = static_cast<uint8>(EventIndex);
+			Event.Value = FInputActionValue(static_cast<EInputActionValueType>(ValueType), Axes);
+		}
+	}
+
+	bOutSuccess = !Ar.IsError();
+	return true;
+}
+
+int64 FEasyEIForwardedInput::GetNumBits() const
+{
+	FBitWriter Writer(0, true);
+	bool bSuccess = false;
+	const_cast<FEasyEIForwardedInput*>(this)->NetSerialize(Writer, nullptr, bSuccess);
+	return Writer.GetNumBits();
+}
@@ -0,0 +1,63 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+
+#include "EasyEIBindingsLatency.h"
+
+
+void FEasyEILatencyHistogram::AddSample(double Microseconds, uint64 Frames)
+{
+	++MicrosecondBuckets[GetMicrosecondBucket(Microseconds)];
+	++FrameBuckets[FMath::Min<uint64>(Frames, NumFrameBuckets - 1)];
+	++SampleCount;
+}
+
+FEasyEILatencyStats FEasyEILatencyHistogram::GetStats() const
+{
+	FEasyEILatencyStats Stats;
+	Stats.SampleCount = SampleCount;
+	if (SampleCount == 0)
+	{
+		return Stats;
+	}
+
+	Stats.P50Microseconds = GetMicrosecondBucketUpperBound(FindPercentileBucket(MicrosecondBuckets, NumMicrosecondBuckets, 0.50f));
+	Stats.P95Microseconds = GetMicrosecondBucketUpperBound(FindPercentileBucket(MicrosecondBuckets, NumMicrosecondBuckets, 0.95f));
+	Stats.P99Microseconds = GetMicrosecondBucketUpperBound(FindPercentileBucket(MicrosecondBuckets, NumMicrosecondBuckets, 0.99f));
+	Stats.P50Frames = FindPercentileBucket(FrameBuckets, NumFrameBuckets, 0.50f);
+	Stats.P95Frames = FindPercentileBucket(FrameBuckets, NumFrameBuckets, 0.95f);
+	Stats.P99Frames = FindPercentileBucket(FrameBuckets, NumFrameBuckets, 0.99f);
+	return Stats;
+}
+
+void FEasyEILatencyHistogram::Reset()
+{
+	*this = FEasyEILatencyHistogram();
+}
+
+int32 FEasyEILatencyHistogram::GetMicrosecondBucket(double Microseconds)
+{
+	// Four buckets per power of two, starting at 1us
+	const double Clamped = FMath::Max(Microseconds, 1.0);
+	const int32 Bucket = FMath::FloorToInt32(FMath::Log2(Clamped) * 4.0);
+	return FMath::Clamp(Bucket, 0, NumMicrosecondBuckets - 1);
+}
+
+double FEasyEILatencyHistogram::GetMicrosecondBucketUpperBound(int32 Bucket)
+{
+	return FMath::Pow(2.0, (Bucket + 1) / 4.0);
+}
+
+int32 FEasyEILatencyHistogram::FindPercentileBucket(const uint32* Buckets, int32 NumBuckets, float Percentile) const
+{
+	const uint64 Target = FMath::CeilToInt64(SampleCount * Percentile);
+	uint64 Cumulative = 0;
+	for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+	{
+		Cumulative += Buckets[Bucket];
+		if (Cumulative >= Target)
+		{
+			return Bucket;
+		}
+	}
+	return NumBuckets - 1;
+}
@@ -0,0 +1,362 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+
+#include "EasyEIBindingsRecording.h"
+
+#include "EasyEIBindings.h"
+#include "EasyEIBindingsCache.h"
+#include "InputAction.h"
+#include "Engine/AssetManager.h"
+#include "Engine/StreamableManager.h"
+#include "HAL/FileManager.h"
+#include "Serialization/MemoryReader.h"
+#include "Serialization/MemoryWriter.h"
+
+
+namespace EasyEIBindingsRecording
+{
+	constexpr uint32 FileMagic = 0x52494545; // "EEIR"
+	constexpr uint32 FileVersion = 1;
+
+	// Chunks are written once they pass this size, bounding what is held in memory
+	constexpr int32 ChunkSizeBytes = 64 * 1024;
+
+	// Guards against reading a corrupt size as a huge allocation
+	constexpr uint32 MaxChunkSizeBytes = 16 * 1024 * 1024;
+
+	static uint32 FloatToBits(float Value)
+	{
+		uint32 Bits;
+		FMemory::Memcpy(&Bits, &Value, sizeof(Bits));
+		return Bits;
+	}
+
+	static float BitsToFloat(uint32 Bits)
+	{
+		float Value;
+		FMemory::Memcpy(&Value, &Bits, sizeof(Value));
+		return Value;
+	}
+
+	static int32 GetNumComponents(EInputActionValueType ValueType)
+	{
+		// Booleans are stored as a single 0 or 1 component
+		return ValueType == EInputActionValueType::Boolean ? 1 : static_cast<int32>(ValueType);
+	}
+}
+
+TUniquePtr<FEasyEIInputRecorder> FEasyEIInputRecorder::Create(const FString& Filename)
+{
+	TUniquePtr<FArchive> FileWriter(IFileManager::Get().CreateFileWriter(*Filename));
+	if (!FileWriter)
+	{
+		UE_LOG(LogEasyEIBindings, Warning, TEXT("%hs: Could not create %s."), __FUNCTION__, *Filename);
+		return nullptr;
+	}
+
+	uint32 Magic = EasyEIBindingsRecording::FileMagic;
+	uint32 Version = EasyEIBindingsRecording::FileVersion;
+	*FileWriter << Magic << Version;
+
+	return TUniquePtr<FEasyEIInputRecorder>(new FEasyEIInputRecorder(MoveTemp(FileWriter)));
+}
+
+FEasyEIInputRecorder::FEasyEIInputRecorder(TUniquePtr<FArchive>&& InFileWriter)
+	: FileWriter(MoveTemp(InFileWriter))
+	, StartFrame(GFrameCounter)
+	, StartCycles(FPlatformTime::Cycles64())
+{
+	ChunkData.Reserve(EasyEIBindingsRecording::ChunkSizeBytes + 256);
+}
+
+FEasyEIInputRecorder::~FEasyEIInputRecorder()
+{
+	Close();
+}
+
+void FEasyEIInputRecorder::Record(const UInputAction* Action, int32 EventIndex, const FInputActionValue& Value)
+{
+	if (!FileWriter || !Action)
+	{
+		return;
+	}
+
+	const uint64 Frame = GFrameCounter - StartFrame;
+	const uint64 Microseconds = static_cast<uint64>(FPlatformTime::ToSeconds64(FPlatformTime::Cycles64() - StartCycles) * 1000000.0);
+
+	if (ChunkNumEvents == 0)
+	{
+		ChunkBaseFrame = PreviousFrame = Frame;
+		ChunkBaseMicroseconds = PreviousMicroseconds = Microseconds;
+	}
+
+	FMemoryWriter Writer(ChunkData, false, true);
+
+	uint64 FrameDelta = Frame - PreviousFrame;
+	uint64 MicrosecondDelta = Microseconds - PreviousMicroseconds;
+	Writer.SerializeIntPacked64(FrameDelta);
+	Writer.SerializeIntPacked64(MicrosecondDelta);
+	PreviousFrame = Frame;
+	PreviousMicroseconds = Microseconds;
+
+	// An index equal to the table size defines the next action by path
+	uint32 ActionIndex = ActionIndices.Num();
+	if (const uint32* Found = ActionIndices.Find(FObjectKey(Action)))
+	{
+		ActionIndex = *Found;
+		Writer.SerializeIntPacked(ActionIndex);
+	}
+	else
+	{
+		ActionIndices.Add(FObjectKey(Action), ActionIndex);
+		PreviousValues.AddZeroed();
+
+		FString ActionPath = Action->GetPathName();
+		Writer.SerializeIntPacked(ActionIndex);
+		Writer << ActionPath;
+	}
+
+	const EInputActionValueType ValueType = Value.GetValueType();
+	uint8 Header = static_cast<uint8>(EventIndex) | static_cast<uint8>(ValueType) << 3;
+	Writer << Header;
+
+	const FVector3f Components(Value.Get<FVector>());
+	FVector3f& PreviousValue = PreviousValues[ActionIndex];
+	for (int32 Component = 0; Component < EasyEIBindingsRecording::GetNumComponents(ValueType); ++Component)
+	{
+		// Repeated values XOR to zero and pack into a single byte
+		uint32 Delta = EasyEIBindingsRecording::FloatToBits(Components[Component])
+			^ EasyEIBindingsRecording::FloatToBits(PreviousValue[Component]);
+		Writer.SerializeIntPacked(Delta);
+		PreviousValue[Component] = Components[Component];
+	}
+
+	++ChunkNumEvents;
+	++NumEvents;
+
+	if (ChunkData.Num() >= EasyEIBindingsRecording::ChunkSizeBytes)
+	{
+		FlushChunk();
+	}
+}
+
+void FEasyEIInputRecorder::FlushChunk()
+{
+	if (!FileWriter || ChunkNumEvents == 0)
+	{
+		return;
+	}
+
+	uint32 PayloadSize = ChunkData.Num();
+	uint32 NumChunkEvents = ChunkNumEvents;
+	*FileWriter << PayloadSize << NumChunkEvents << ChunkBaseFrame << ChunkBaseMicroseconds;
+	FileWriter->Serialize(ChunkData.GetData(), ChunkData.Num());
+
+	ChunkData.Reset();
+	ChunkNumEvents = 0;
+}
+
+void FEasyEIInputRecorder::Close()
+{
+	if (!FileWriter)
+	{
+		return;
+	}
+
+	FlushChunk();
+	FileWriter->Close();
+	FileWriter.Reset();
+}
+
+int64 FEasyEIInputRecorder::GetNumBytesWritten() const
+{
+	return (FileWriter ? FileWriter->Tell() : 0) + ChunkData.Num();
+}
+
+TUniquePtr<FEasyEIInputPlayer> FEasyEIInputPlayer::Open(const FString& Filename)
+{
+	TUniquePtr<FArchive> FileReader = OpenReader(Filename);
+	if (!FileReader)
+	{
+		return nullptr;
+	}
+
+	TUniquePtr<FEasyEIInputPlayer> Player(new FEasyEIInputPlayer(MoveTemp(FileReader)));
+	Player->PreloadActions(Filename);
+	return Player;
+}
+
+TUniquePtr<FArchive> FEasyEIInputPlayer::OpenReader(const FString& Filename)
+{
+	TUniquePtr<FArchive> FileReader(IFileManager::Get().CreateFileReader(*Filename));
+	if (!FileReader)
+	{
+		UE_LOG(LogEasyEIBindings, Warning, TEXT("%hs: Could not open %s."), __FUNCTION__, *Filename);
+		return nullptr;
+	}
+
+	uint32 Magic = 0;
+	uint32 Version = 0;
+	*FileReader << Magic << Version;
+	if (Magic != EasyEIBindingsRecording::FileMagic || Version != EasyEIBindingsRecording::FileVersion)
+	{
+		UE_LOG(LogEasyEIBindings, Warning, TEXT("%hs: %s is not a supported input recording."), __FUNCTION__, *Filename);
+		return nullptr;
+	}
+	return FileReader;
+}
+
+void FEasyEIInputPlayer::PreloadActions(const FString& Filename)
+{
+	// Actions are defined inline where they first appear, so a separate pass over the file collects the whole
+	// table and loads it here rather than in the middle of the replay
+	FEasyEIInputPlayer Scanner(OpenReader(Filename));
+	FEasyEIRecordedEvent Event;
+	while (Scanner.ReadEvent(Event))
+	{
+	}
+
+	TArray<FSoftObjectPath> Paths;
+	Paths.Reserve(Scanner.ActionPaths.Num());
+	for (const FString& ActionPath : Scanner.ActionPaths)
+	{
+		Paths.Emplace(ActionPath);
+	}
+
+	// One batched load, held by the handle so garbage collection cannot drop actions between replayed events
+	if (Paths.Num() > 0)
+	{
+		ActionsLoadHandle = UAssetManager::GetStreamableManager().RequestSyncLoad(Paths);
+	}
+
+	Actions.Reserve(Paths.Num());
+	for (const FSoftObjectPath& Path : Paths)
+	{
+		Actions.Add(Cast<UInputAction>(Path.ResolveObject()));
+	}
+}
+
+FEasyEIInputPlayer::FEasyEIInputPlayer(TUniquePtr<FArchive>&& InFileReader)
+	: FileReader(MoveTemp(InFileReader))
+{
+}
+
+bool FEasyEIInputPlayer::Advance(uint64 FrameOffset, TFunctionRef<void(const FEasyEIRecordedEvent&)> Func)
+{
+	while (true)
+	{
+		if (!bHasNextEvent)
+		{
+			bHasNextEvent = ReadEvent(NextEvent);
+			if (!bHasNextEvent)
+			{
+				return false;
+			}
+		}
+
+		if (!bStarted)
+		{
+			FirstFrame = NextEvent.Frame;
+			bStarted = true;
+		}
+
+		if (NextEvent.Frame - FirstFrame > FrameOffset)
+		{
+			return true;
+		}
+
+		bHasNextEvent = false;
+		if (NextEvent.Action)
+		{
+			Func(NextEvent);
+		}
+	}
+}
+
+bool FEasyEIInputPlayer::ReadChunk()
+{
+	if (!FileReader || FileReader->AtEnd())
+	{
+		return false;
+	}
+
+	uint32 PayloadSize = 0;
+	uint32 NumChunkEvents = 0;
+	*FileReader << PayloadSize << NumChunkEvents << PreviousFrame << PreviousMicroseconds;
+	if (FileReader->IsError() || PayloadSize > EasyEIBindingsRecording::MaxChunkSizeBytes
+		|| FileReader->Tell() + PayloadSize > FileReader->TotalSize())
+	{
+		// A truncated last chunk, e.g. from a crash, ends the replay
+		return false;
+	}
+
+	ChunkData.Reset();
+	ChunkData.AddUninitialized(PayloadSize);
+	FileReader->Serialize(ChunkData.GetData(), PayloadSize);
+	ChunkOffset = 0;
+	ChunkEventsLeft = NumChunkEvents;
+	return !FileReader->IsError();
+}
+
+bool FEasyEIInputPlayer::ReadEvent(FEasyEIRecordedEvent& OutEvent)
+{
+	while (ChunkEventsLeft == 0)
+	{
+		if (!ReadChunk())
+		{
+			return false;
+		}
+	}
+
+	FMemoryReader Reader(ChunkData);
+	Reader.Seek(ChunkOffset);
+
+	uint64 FrameDelta = 0;
+	uint64 MicrosecondDelta = 0;
+	Reader.SerializeIntPacked64(FrameDelta);
+	Reader.SerializeIntPacked64(MicrosecondDelta);
+	PreviousFrame += FrameDelta;
+	PreviousMicroseconds += MicrosecondDelta;
+
+	uint32 ActionIndex = 0;
+	Reader.SerializeIntPacked(ActionIndex);
+	if (ActionIndex == static_cast<uint32>(ActionPaths.Num()))
+	{
+		FString& ActionPath = ActionPaths.AddDefaulted_GetRef();
+		Reader << ActionPath;
+		PreviousValues.AddZeroed();
+	}
+
+	uint8 Header = 0;
+	Reader << Header;
+
+	if (Reader.IsError() || !ActionPaths.IsValidIndex(ActionIndex))
+	{
+		UE_LOG(LogEasyEIBindings, Warning, TEXT("%hs: Input recording is corrupt, stopping replay."), __FUNCTION__);
+		ChunkEventsLeft = 0;
+		FileReader.Reset();
+		return false;
+	}
+
+	const int32 EventIndex = FMath::Min<int32>(Header & 0x7, EasyEIBindings::NumTriggerEvents - 1);
+	const EInputActionValueType ValueType = static_cast<EInputActionValueType>(FMath::Min(Header >> 3, 3));
+
+	FVector3f& PreviousValue = PreviousValues[ActionIndex];
+	for (int32 Component = 0; Component < EasyEIBindingsRecording::GetNumComponents(ValueType); ++Component)
+	{
+		uint32 Delta = 0;
+		Reader.SerializeIntPacked(Delta);
+		PreviousValue[Component] = EasyEIBindingsRecording::BitsToFloat(
+			Delta ^ EasyEIBindingsRecording::FloatToBits(PreviousValue[Component]));
+	}
+
+	ChunkOffset = Reader.Tell();
+	--ChunkEventsLeft;
+
+	OutEvent.Action = Actions.IsValidIndex(ActionIndex) ? Actions[ActionIndex].Get() : nullptr;
+	OutEvent.EventIndex = EventIndex;
+	OutEvent.Value = FInputActionValue(ValueType, FVector(PreviousValue));
+	OutEvent.Frame = PreviousFrame;
+	OutEvent.Microseconds = PreviousMicroseconds;
+	return true;
+}
@@ -0,0 +1,16 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+
+#include "EasyEIBindingsRuntimeSettings.h"
+
+
+UEasyEIBindingsRuntimeSettings::UEasyEIBindingsRuntimeSettings()
+{
+	bTimeSliceSetup = false;
+	SetupTimeBudgetMs = 1.0f;
+}
+
+const UEasyEIBindingsRuntimeSettings* UEasyEIBindingsRuntimeSettings::Get()
+{
+	return GetDefault<UEasyEIBindingsRuntimeSettings>();
+}
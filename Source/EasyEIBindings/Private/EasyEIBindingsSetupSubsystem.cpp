@@ -0,0 +1,161 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+
+#include "EasyEIBindingsSetupSubsystem.h"
+
+#include "EasyEIBindings.h"
+#include "EasyEIBindingsComponent.h"
+#include "EasyEIBindingsRuntimeSettings.h"
+#include "Engine/GameInstance.h"
+#include "Engine/World.h"
+#include "GameFramework/Pawn.h"
+#include "GameFramework/PlayerController.h"
+
+DECLARE_CYCLE_STAT(TEXT("Process Setup Queue"), STAT_EasyEIBindings_ProcessSetupQueue, STATGROUP_EasyEIBindings);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Setup Queue Depth"), STAT_EasyEIBindings_SetupQueueDepth, STATGROUP_EasyEIBindings);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Setup Budget Overruns"), STAT_EasyEIBindings_SetupBudgetOverruns, STATGROUP_EasyEIBindings);
+
+
+static bool IsPlayerControlledOwner(const AActor* Owner)
+{
+	if (const APawn* Pawn = Cast<APawn>(Owner))
+	{
+		return Pawn->IsPlayerControlled();
+	}
+	return Owner && Owner->IsA<APlayerController>();
+}
+
+bool UEasyEIBindingsSetupSubsystem::FSetupQueue::Pop(TWeakObjectPtr<UEasyEIBindingsComponent>& OutEntry)
+{
+	if (Head >= Entries.Num())
+	{
+		return false;
+	}
+
+	OutEntry = Entries[Head++];
+	if (Head == Entries.Num())
+	{
+		// Drained, reuse the allocation for the next wave
+		Entries.Reset();
+		Head = 0;
+	}
+	return true;
+}
+
+void UEasyEIBindingsSetupSubsystem::EnqueueSetup(UEasyEIBindingsComponent* Component)
+{
+	if (!Component || Component->bSetupQueued)
+	{
+		return;
+	}
+
+	Component->bSetupQueued = true;
+
+	FSetupQueue& Queue = IsPlayerControlledOwner(Component->GetOwner()) ? PlayerQueue : DeferredQueue;
+	Queue.Entries.Add(Component);
+}
+
+void UEasyEIBindingsSetupSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	if (UGameInstance* GameInstance = InWorld.GetGameInstance())
+	{
+		GameInstance->OnPawnControllerChangedDelegates.AddUniqueDynamic(
+			this, &UEasyEIBindingsSetupSubsystem::HandlePawnControllerChanged);
+	}
+}
+
+void UEasyEIBindingsSetupSubsystem::Deinitialize()
+{
+	const UWorld* World = GetWorld();
+	if (UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr)
+	{
+		GameInstance->OnPawnControllerChangedDelegates.RemoveDynamic(
+			this, &UEasyEIBindingsSetupSubsystem::HandlePawnControllerChanged);
+	}
+
+	Super::Deinitialize();
+}
+
+void UEasyEIBindingsSetupSubsystem::HandlePawnControllerChanged(APawn* Pawn, AController* Controller)
+{
+	// Streamed pawns are usually queued before they are possessed, so they move ahead once a player takes them.
+	// The deferred entry stays behind and is skipped, setup clears bSetupQueued.
+	if (!Pawn || Pawn->GetWorld() != GetWorld() || !IsPlayerControlledOwner(Pawn))
+	{
+		return;
+	}
+
+	TInlineComponentArray<UEasyEIBindingsComponent*> Components(Pawn);
+	for (UEasyEIBindingsComponent* Component : Components)
+	{
+		if (Component->bSetupQueued)
+		{
+			PlayerQueue.Entries.Add(Component);
+		}
+	}
+}
+
+int32 UEasyEIBindingsSetupSubsystem::GetQueueDepth() const
+{
+	return PlayerQueue.Num() + DeferredQueue.Num();
+}
+
+void UEasyEIBindingsSetupSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	SET_DWORD_STAT(STAT_EasyEIBindings_SetupQueueDepth, GetQueueDepth());
+	if (GetQueueDepth() == 0)
+	{
+		return;
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_EasyEIBindings_ProcessSetupQueue);
+
+	const UEasyEIBindingsRuntimeSettings* Settings = UEasyEIBindingsRuntimeSettings::Get();
+	const double BudgetSeconds = (Settings ? Settings->SetupTimeBudgetMs : 1.0f) / 1000.0;
+	const double StartTime = FPlatformTime::Seconds();
+
+	int32 NumProcessed = 0;
+	TWeakObjectPtr<UEasyEIBindingsComponent> Entry;
+	while (PlayerQueue.Pop(Entry) || DeferredQueue.Pop(Entry))
+	{
+		UEasyEIBindingsComponent* Component = Entry.Get();
+
+		// Skip components that ended play or were set up manually while queued
+		if (!Component || !Component->bSetupQueued || !Component->HasBegunPlay())
+		{
+			continue;
+		}
+
+		Component->SetupInputActions();
+		++NumProcessed;
+
+		// Always make progress, then stop once the budget is spent
+		if (FPlatformTime::Seconds() - StartTime >= BudgetSeconds)
+		{
+			break;
+		}
+	}
+
+	const double ElapsedSeconds = FPlatformTime::Seconds() - StartTime;
+	if (ElapsedSeconds > BudgetSeconds)
+	{
+		++BudgetOverrunCount;
+		INC_DWORD_STAT(STAT_EasyEIBindings_SetupBudgetOverruns);
+		UE_LOG(LogEasyEIBindings, Verbose, TEXT("%hs: Processed %d setup(s) in %.3f ms, over the %.3f ms budget. %d still queued."),
+		       __FUNCTION__, NumProcessed, ElapsedSeconds * 1000.0, BudgetSeconds * 1000.0, GetQueueDepth());
+	}
+}
+
+TStatId UEasyEIBindingsSetupSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UEasyEIBindingsSetupSubsystem, STATGROUP_Tickables);
+}
+
+bool UEasyEIBindingsSetupSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+	return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
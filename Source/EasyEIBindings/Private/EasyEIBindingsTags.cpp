@@ -0,0 +1,71 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+
+#include "EasyEIBindingsTags.h"
+
+
+namespace EasyEIBindings
+{
+	const FName BindingsTag(TEXT("EasyEIBindings"));
+	const FName HandlersTag(TEXT("EasyEIHandlers"));
+	const FName TaggedBlueprintTag(TEXT("EasyEITagged"));
+}
+
+FString FEasyEIBindingTagEntry::ToString() const
+{
+	TArray<FString> Handlers;
+	Handlers.Reserve(HandlerNames.Num());
+	for (const FName& HandlerName : HandlerNames)
+	{
+		Handlers.Add(HandlerName.ToString());
+	}
+
+	return FString::Printf(TEXT("%s|%s|%d|%s"), *OwnerClassPath, *ActionPath, EnabledEventSlots,
+	                       *FString::Join(Handlers, TEXT("+")));
+}
+
+bool FEasyEIBindingTagEntry::Parse(const FString& Text, FEasyEIBindingTagEntry& OutEntry)
+{
+	TArray<FString> Fields;
+	Text.ParseIntoArray(Fields, TEXT("|"), false);
+	if (Fields.Num() != 4 || Fields[0].IsEmpty() || Fields[1].IsEmpty())
+	{
+		return false;
+	}
+
+	OutEntry.OwnerClassPath = MoveTemp(Fields[0]);
+	OutEntry.ActionPath = MoveTemp(Fields[1]);
+	OutEntry.EnabledEventSlots = static_cast<uint8>(FCString::Atoi(*Fields[2]));
+
+	TArray<FString> Handlers;
+	Fields[3].ParseIntoArray(Handlers, TEXT("+"));
+	OutEntry.HandlerNames.Reset(Handlers.Num());
+	for (const FString& Handler : Handlers)
+	{
+		OutEntry.HandlerNames.Add(FName(*Handler));
+	}
+	return true;
+}
+
+TArray<FEasyEIBindingTagEntry> FEasyEIBindingTagEntry::ParseList(const FString& TagValue)
+{
+	TArray<FString> Texts;
+	TagValue.ParseIntoArray(Texts, TEXT(";"));
+
+	TArray<FEasyEIBindingTagEntry> Entries;
+	Entries.Reserve(Texts.Num());
+	for (const FString& Text : Texts)
+	{
+		FEasyEIBindingTagEntry Entry;
+		if (Parse(Text, Entry))
+		{
+			Entries.Add(MoveTemp(Entry));
+		}
+	}
+	return Entries;
+}
+
+FString FEasyEIBindingTagEntry::JoinList(TConstArrayView<FString> Entries)
+{
+	return FString::Join(Entries, TEXT(";"));
+}
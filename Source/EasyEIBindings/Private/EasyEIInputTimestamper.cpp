@@ -0,0 +1,62 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+
+#include "EasyEIInputTimestamper.h"
+
+
+bool FEasyEIInputTimestamper::HandleKeyDownEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	Stamp(InKeyEvent.GetKey());
+	return false;
+}
+
+bool FEasyEIInputTimestamper::HandleKeyUpEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent)
+{
+	Stamp(InKeyEvent.GetKey());
+	return false;
+}
+
+bool FEasyEIInputTimestamper::HandleAnalogInputEvent(FSlateApplication& SlateApp, const FAnalogInputEvent& InAnalogInputEvent)
+{
+	Stamp(InAnalogInputEvent.GetKey());
+	return false;
+}
+
+bool FEasyEIInputTimestamper::HandleMouseMoveEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
+{
+	Stamp(EKeys::Mouse2D);
+	Stamp(EKeys::MouseX);
+	Stamp(EKeys::MouseY);
+	return false;
+}
+
+bool FEasyEIInputTimestamper::HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
+{
+	Stamp(MouseEvent.GetEffectingButton());
+	return false;
+}
+
+bool FEasyEIInputTimestamper::HandleMouseButtonUpEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent)
+{
+	Stamp(MouseEvent.GetEffectingButton());
+	return false;
+}
+
+bool FEasyEIInputTimestamper::HandleMouseWheelOrGestureEvent(FSlateApplication& SlateApp, const FPointerEvent& InWheelEvent,
+                                                             const FPointerEvent* InGestureEvent)
+{
+	Stamp(EKeys::MouseWheelAxis);
+	return false;
+}
+
+const FEasyEIInputStamp* FEasyEIInputTimestamper::FindStamp(const FKey& Key) const
+{
+	return Stamps.Find(Key);
+}
+
+void FEasyEIInputTimestamper::Stamp(const FKey& Key)
+{
+	FEasyEIInputStamp& InputStamp = Stamps.FindOrAdd(Key);
+	InputStamp.Cycles = FPlatformTime::Cycles64();
+	InputStamp.Frame = GFrameCounter;
+}
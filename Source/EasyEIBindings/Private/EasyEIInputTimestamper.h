@@ -0,0 +1,46 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Framework/Application/IInputProcessor.h"
+#include "InputCoreTypes.h"
+
+/**
+ * Time and frame at which a raw input event for a key reached Slate.
+ */
+struct FEasyEIInputStamp
+{
+	uint64 Cycles = 0;
+	uint64 Frame = 0;
+};
+
+/**
+ * Slate input pre-processor that records when raw key, mouse and analog events arrive,
+ * before Enhanced Input evaluates them. Never consumes events.
+ */
+class FEasyEIInputTimestamper : public IInputProcessor
+{
+public:
+	virtual void Tick(const float DeltaTime, FSlateApplication& SlateApp, TSharedRef<ICursor> Cursor) override
+	{
+	}
+
+	virtual bool HandleKeyDownEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent) override;
+	virtual bool HandleKeyUpEvent(FSlateApplication& SlateApp, const FKeyEvent& InKeyEvent) override;
+	virtual bool HandleAnalogInputEvent(FSlateApplication& SlateApp, const FAnalogInputEvent& InAnalogInputEvent) override;
+	virtual bool HandleMouseMoveEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override;
+	virtual bool HandleMouseButtonDownEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override;
+	virtual bool HandleMouseButtonUpEvent(FSlateApplication& SlateApp, const FPointerEvent& MouseEvent) override;
+	virtual bool HandleMouseWheelOrGestureEvent(FSlateApplication& SlateApp, const FPointerEvent& InWheelEvent,
+	                                            const FPointerEvent* InGestureEvent) override;
+
+	virtual const TCHAR* GetDebugName() const override { return TEXT("EasyEIInputTimestamper"); }
+
+	const FEasyEIInputStamp* FindStamp(const FKey& Key) const;
+
+private:
+	void Stamp(const FKey& Key);
+
+	TMap<FKey, FEasyEIInputStamp> Stamps;
+};
@@ -0,0 +1,45 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "EasyEIBindingsComponent.h"
+#include "EasyEIBindingSet.generated.h"
+
+struct FStreamableHandle;
+
+/**
+ * Bindings shared by every component that references the asset. Handlers are resolved once per
+ * owner class and reused by all instances, so many identical actors carry no per-instance copy.
+ * Treated as read-only at runtime.
+ */
+UCLASS(BlueprintType)
+class EASYEIBINDINGS_API UEasyEIBindingSet : public UPrimaryDataAsset
+{
+	GENERATED_BODY()
+
+public:
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Easy EI Bindings")
+	TArray<FEasyEIBinding> Bindings;
+
+	/**
+	 * Starts loading every soft action of the set in one batched request, or joins the request in flight.
+	 * Actions stay loaded while any returned handle is held. Null when the set has no soft actions.
+	 */
+	TSharedPtr<FStreamableHandle> RequestPreload();
+
+	/** Broadcast when a preload request completes. */
+	FSimpleMulticastDelegate& OnPreloadComplete() { return PreloadCompleteDelegate; }
+
+#if WITH_EDITOR
+	virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+	void HandlePreloadComplete();
+
+	TWeakPtr<FStreamableHandle> PreloadHandle;
+
+	FSimpleMulticastDelegate PreloadCompleteDelegate;
+};
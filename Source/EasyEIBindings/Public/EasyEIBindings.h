@@ -3,9 +3,18 @@
 #pragma once
 
 #include "Modules/ModuleManager.h"
+#include "Stats/Stats.h"
+#include "Trace/Trace.h"
+#include "EasyEIBindingsCache.h"
+
+class FEasyEIInputTimestamper;
 
 DECLARE_LOG_CATEGORY_EXTERN(LogEasyEIBindings, Log, All);
 
+DECLARE_STATS_GROUP(TEXT("EasyEIBindings"), STATGROUP_EasyEIBindings, STATCAT_Advanced);
+
+UE_TRACE_CHANNEL_EXTERN(EasyEIBindingsChannel, EASYEIBINDINGS_API);
+
 class FEasyEIBindingsModule : public IModuleInterface
 {
 public:
@@ -13,4 +22,26 @@ public:
 	/** IModuleInterface implementation */
 	virtual void StartupModule() override;
 	virtual void ShutdownModule() override;
+
+	static FEasyEIBindingsModule& Get()
+	{
+		return FModuleManager::GetModuleChecked<FEasyEIBindingsModule>("EasyEIBindings");
+	}
+
+	/** Handler resolution shared by every EasyEIBindingsComponent. */
+	FEasyEIBindingsCache& GetBindingCache() { return BindingCache; }
+
+	/** Raw input arrival times, registered with Slate on first use. Null when Slate is not running. */
+	const FEasyEIInputTimestamper* GetInputTimestamper();
+
+private:
+	void HandleReloadComplete(EReloadCompleteReason Reason);
+	void HandlePostGarbageCollect();
+
+	FEasyEIBindingsCache BindingCache;
+
+	TSharedPtr<FEasyEIInputTimestamper> InputTimestamper;
+
+	FDelegateHandle ReloadCompleteHandle;
+	FDelegateHandle PostGarbageCollectHandle;
 };
@@ -0,0 +1,112 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputTriggers.h"
+#include "UObject/ObjectKey.h"
+
+class UClass;
+class UEasyEIBindingSet;
+class UFunction;
+class UInputAction;
+
+namespace EasyEIBindings
+{
+	/** Number of trigger events a binding can route to a handler. */
+	constexpr int32 NumTriggerEvents = 5;
+
+	/** Trigger event handled by the given event slot. */
+	EASYEIBINDINGS_API ETriggerEvent GetTriggerEvent(int32 EventIndex);
+
+	/** Event slot handling the given trigger event, INDEX_NONE for events that are never bound. */
+	EASYEIBINDINGS_API int32 GetTriggerEventIndex(ETriggerEvent Event);
+
+	/** Handler name suffix for the given event slot, e.g. "Triggered". */
+	EASYEIBINDINGS_API const TCHAR* GetTriggerEventSuffix(int32 EventIndex);
+
+	/** Name of the handler an owner implements for the action and event slot, e.g. IA_Jump_Started. */
+	EASYEIBINDINGS_API FName MakeHandlerName(const UInputAction* Action, int32 EventIndex);
+
+	/** Handler name from an action's asset name, for actions that are not loaded. */
+	EASYEIBINDINGS_API FName MakeHandlerName(FString ActionName, int32 EventIndex);
+}
+
+/**
+ * Handlers resolved on an owner class for a single Input Action, indexed by event slot.
+ */
+struct FEasyEIResolvedAction
+{
+	FName HandlerNames[EasyEIBindings::NumTriggerEvents];
+
+	// Null where the owner class does not implement the handler.
+	UFunction* Handlers[EasyEIBindings::NumTriggerEvents] = {};
+};
+
+/**
+ * One binding of a binding set, resolved on an owner class.
+ */
+struct FEasyEIResolvedSetBinding
+{
+	const UInputAction* Action = nullptr;
+
+	// Index of the source entry in the set's Bindings
+	int32 BindingIndex = INDEX_NONE;
+
+	// Bit N set when event slot N is enabled by the set
+	uint8 EnabledEventSlots = 0;
+
+	FEasyEIResolvedAction Resolved;
+};
+
+/**
+ * Resolved table of a binding set on an owner class, shared read-only by every component using the pair.
+ */
+struct FEasyEIResolvedBindingSet
+{
+	TArray<FEasyEIResolvedSetBinding> Bindings;
+};
+
+/**
+ * Caches handler resolution per owner class and Input Action, so that instances of
+ * an already seen class bind without formatting names or searching the class again.
+ */
+class EASYEIBINDINGS_API FEasyEIBindingsCache
+{
+public:
+	/** Returns the handlers for the action, resolving them on first use. Only valid until the next call. */
+	const FEasyEIResolvedAction& FindOrResolve(const UClass* OwnerClass, const UInputAction* Action);
+
+	/**
+	 * Returns the cached handlers for the action, validating names baked on save the first time the class
+	 * and action are seen. Slots without a baked name are resolved as usual. Only valid until the next call.
+	 */
+	const FEasyEIResolvedAction& FindOrSeed(const UClass* OwnerClass, const UInputAction* Action,
+	                                        const FName (&BakedHandlerNames)[EasyEIBindings::NumTriggerEvents]);
+
+	/** Resolves the handlers for the action without going through the cache. */
+	static FEasyEIResolvedAction Resolve(const UClass* OwnerClass, const UInputAction* Action);
+
+	/** Returns the resolved table of a binding set for the owner class, building it on first use. Only valid until the next call. */
+	const FEasyEIResolvedBindingSet& FindOrResolveSet(const UClass* OwnerClass, const UEasyEIBindingSet* BindingSet);
+
+	/** Drops every entry. Called when classes are recompiled or reloaded. */
+	void Invalidate();
+
+	/** Drops entries whose class or action has been garbage collected. */
+	void PurgeStaleEntries();
+
+	/** Incremented by every Invalidate, so results derived from the cache can tell they are stale. */
+	uint32 GetGeneration() const { return Generation; }
+
+private:
+	using FKey = TPair<FObjectKey, FObjectKey>;
+
+	TMap<FKey, FEasyEIResolvedAction> Entries;
+	TMap<FKey, FEasyEIResolvedBindingSet> SetEntries;
+
+	// Returned for sets whose soft actions have not all loaded, rebuilt on every request
+	FEasyEIResolvedBindingSet IncompleteSet;
+
+	uint32 Generation = 0;
+};
@@ -5,13 +5,49 @@
 #include "CoreMinimal.h"
 #include "InputAction.h"
 #include "InputTriggers.h"
+#include "EasyEIBindingsCache.h"
+#include "EasyEIBindingsForwarding.h"
+#include "EasyEIBindingsLatency.h"
+#include "EasyEIBindingsRecording.h"
+#include "EnhancedInputComponent.h"
 #include "Components/ActorComponent.h"
 #include "EasyEIBindingsComponent.generated.h"
 
 
+class AController;
+class APawn;
+class UEasyEIBindingSet;
+struct FStreamableHandle;
+class UEnhancedInputLocalPlayerSubsystem;
 class UInputAction;
 class UInputMappingContext;
 
+/**
+ * How Triggered values of one action are combined into a single call per frame.
+ */
+UENUM(BlueprintType)
+enum class EEasyEIValueCoalescing : uint8
+{
+	// Every Triggered event calls the handler
+	None,
+	// Sum the values, for deltas such as mouse look
+	Sum,
+	// Keep the most recent value, for absolutes such as stick position
+	Latest
+};
+
+/**
+ * What happens to a Triggered or Ongoing event that arrives before the binding's minimum interval has passed.
+ */
+UENUM(BlueprintType)
+enum class EEasyEIThrottleMode : uint8
+{
+	// Discard the event
+	Drop,
+	// Keep the latest event and deliver it once the interval has passed
+	Merge
+};
+
 /**
  * Specifies which trigger events to bind for an Input Action.
  */
@@ -23,11 +59,51 @@ struct FEasyEIBinding
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Binding")
 	TObjectPtr<UInputAction> InputAction = nullptr;
 
+	// Used when InputAction is empty. Loaded asynchronously before setup instead of with the owner.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Binding")
+	TSoftObjectPtr<UInputAction> SoftInputAction;
+
 	// Bitmask of which trigger events to bind. Default: Triggered, Started, Completed
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Binding",
 		meta = (Bitmask, BitmaskEnum = "/Script/EnhancedInput.ETriggerEvent"))
 	int32 EnabledEvents = 17;
 
+	// Deliver Triggered at most once per frame from the component's tick, in its Tick Group, with the combined value
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category = "Binding")
+	EEasyEIValueCoalescing TriggeredCoalescing = EEasyEIValueCoalescing::None;
+
+	// Skip a coalesced call when the value is within this distance of the last call (Latest) or of zero (Sum)
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category = "Binding",
+		meta = (ClampMin = "0", EditCondition = "TriggeredCoalescing != EEasyEIValueCoalescing::None"))
+	float CoalesceEpsilon = 0.f;
+
+	// Maximum calls per second of game time for Triggered and Ongoing, 0 for no limit. Started, Completed and Canceled are never throttled.
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category = "Binding", meta = (ClampMin = "0", Units = "Hz"))
+	float MaxDispatchRate = 0.f;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, AdvancedDisplay, Category = "Binding",
+		meta = (EditCondition = "MaxDispatchRate > 0"))
+	EEasyEIThrottleMode ThrottleMode = EEasyEIThrottleMode::Drop;
+
+	/** Minimum seconds between calls for the given event, 0 when the event is not throttled. */
+	float GetMinDispatchInterval(ETriggerEvent Event) const
+	{
+		const bool bContinuous = Event == ETriggerEvent::Triggered || Event == ETriggerEvent::Ongoing;
+		return bContinuous && MaxDispatchRate > 0.f ? 1.f / MaxDispatchRate : 0.f;
+	}
+
+	/** The bound action, from InputAction or otherwise from SoftInputAction once it is loaded. */
+	UInputAction* GetInputAction() const
+	{
+		return InputAction ? InputAction.Get() : SoftInputAction.Get();
+	}
+
+	/** Whether the action is only referenced softly and is not loaded yet. */
+	bool NeedsLoad() const
+	{
+		return !InputAction && !SoftInputAction.IsNull() && !SoftInputAction.IsValid();
+	}
+
 	bool IsEventEnabled(ETriggerEvent Event) const
 	{
 		return (EnabledEvents & (1 << static_cast<int32>(Event))) != 0;
@@ -44,6 +120,212 @@ struct FEasyEIBinding
 			EnabledEvents &= ~(1 << static_cast<int32>(Event));
 		}
 	}
+
+	/** Enabled events as a mask of event slots, bit N for slot N. */
+	uint8 GetEnabledEventSlots() const
+	{
+		uint8 EventSlots = 0;
+		for (int32 EventIndex = 0; EventIndex < EasyEIBindings::NumTriggerEvents; ++EventIndex)
+		{
+			if (IsEventEnabled(EasyEIBindings::GetTriggerEvent(EventIndex)))
+			{
+				EventSlots |= 1 << EventIndex;
+			}
+		}
+		return EventSlots;
+	}
+};
+
+/**
+ * Input Mapping Context added to the owner's local player while the component's bindings are set up.
+ */
+USTRUCT(BlueprintType)
+struct FEasyEIMappingContext
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mapping")
+	TObjectPtr<UInputMappingContext> MappingContext = nullptr;
+
+	// Higher priority contexts take precedence when they map the same keys
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Mapping")
+	int32 Priority = 0;
+};
+
+/**
+ * Bindings bound together with the component's other bindings but only delivered while the set is active,
+ * e.g. one set per movement mode.
+ */
+USTRUCT(BlueprintType)
+struct FEasyEINamedBindingSet
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Binding")
+	FName Name;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Binding")
+	TArray<FEasyEIBinding> Bindings;
+
+	// Added while the set is active
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Binding")
+	TArray<FEasyEIMappingContext> MappingContexts;
+
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Binding")
+	bool bActiveByDefault = false;
+};
+
+/**
+ * Handler names resolved for one binding when the owning Blueprint or level was saved.
+ */
+USTRUCT()
+struct FEasyEIBakedBinding
+{
+	GENERATED_BODY()
+
+	// Action and event mask this entry was baked from, compared at runtime to detect stale data
+	UPROPERTY()
+	TObjectPtr<UInputAction> InputAction = nullptr;
+
+	UPROPERTY()
+	TSoftObjectPtr<UInputAction> SoftInputAction;
+
+	UPROPERTY()
+	int32 EnabledEvents = 0;
+
+	// Handler per event slot, None where the event is disabled or not implemented
+	UPROPERTY()
+	FName HandlerNames[EasyEIBindings::NumTriggerEvents];
+};
+
+/**
+ * Identifies a single (Input Action, trigger event) pair.
+ */
+struct FEasyEIBindingKey
+{
+	const UInputAction* Action = nullptr;
+	ETriggerEvent Event = ETriggerEvent::None;
+
+	FEasyEIBindingKey() = default;
+
+	FEasyEIBindingKey(const UInputAction* InAction, ETriggerEvent InEvent)
+		: Action(InAction), Event(InEvent)
+	{
+	}
+
+	bool operator==(const FEasyEIBindingKey& Other) const
+	{
+		return Action == Other.Action && Event == Other.Event;
+	}
+
+	friend uint32 GetTypeHash(const FEasyEIBindingKey& Key)
+	{
+		return HashCombine(GetTypeHash(Key.Action), GetTypeHash(Key.Event));
+	}
+};
+
+/**
+ * Handler bound for one (action, event) pair and the Enhanced Input handle it was bound with.
+ */
+struct FEasyEIBoundEvent
+{
+	uint32 Handle = 0;
+
+	// Owner function handling the event, unused for native handlers
+	FName HandlerName;
+	UFunction* Function = nullptr;
+
+	int32 EventIndex = INDEX_NONE;
+
+	bool bNative = false;
+
+	// Routed through the component's dispatcher instead of being bound to the owner by name
+	bool bDispatched = false;
+
+	// Triggered only, delivered once per frame by the component's tick
+	EEasyEIValueCoalescing Coalescing = EEasyEIValueCoalescing::None;
+	float CoalesceEpsilon = 0.f;
+
+	// Dispatched only, 0 when the event is not throttled
+	float MinDispatchInterval = 0.f;
+	EEasyEIThrottleMode ThrottleMode = EEasyEIThrottleMode::Drop;
+
+	// Named binding sets enabling the event, bit N for set N. 0 when the event is always delivered.
+	uint32 NamedSetMask = 0;
+
+	bool HasSameTarget(const FEasyEIBoundEvent& Other) const
+	{
+		return bNative == Other.bNative && bDispatched == Other.bDispatched && Function == Other.Function
+			&& Coalescing == Other.Coalescing && CoalesceEpsilon == Other.CoalesceEpsilon
+			&& MinDispatchInterval == Other.MinDispatchInterval && ThrottleMode == Other.ThrottleMode
+			&& NamedSetMask == Other.NamedSetMask;
+	}
+};
+
+/**
+ * Rate limit state of one dispatched event.
+ */
+struct FEasyEIThrottleState
+{
+	float MinInterval = 0.f;
+	EEasyEIThrottleMode Mode = EEasyEIThrottleMode::Drop;
+
+	// World time, so intervals follow pause and time dilation. Starts far in the past so the first event always passes.
+	double LastDispatchSeconds = TNumericLimits<double>::Lowest();
+
+	// Latest over-rate event, held in Merge mode until the interval has passed
+	FInputActionValue MergedValue;
+	float MergedElapsedSeconds = 0.f;
+	float MergedTriggeredSeconds = 0.f;
+	bool bHasMergedEvent = false;
+};
+
+/**
+ * Per-action jump table used by component dispatch, indexed by event slot.
+ */
+struct FEasyEIDispatchSlot
+{
+	const UInputAction* Action = nullptr;
+
+	// Null for events that are disabled or have no handler
+	UFunction* Handlers[EasyEIBindings::NumTriggerEvents] = {};
+
+	// Insights event names, built the first time a handler is traced
+	FString TraceNames[EasyEIBindings::NumTriggerEvents];
+
+	// Keys mapped to the action, looked up the first time latency is measured
+	TArray<FKey> LatencyKeys;
+	bool bLatencyKeysResolved = false;
+
+	// Newest raw input already counted, so held inputs are not sampled every frame
+	uint64 LastMeasuredInputCycles = 0;
+
+	// Triggered values combined since the last tick when the binding coalesces
+	EEasyEIValueCoalescing Coalescing = EEasyEIValueCoalescing::None;
+	float CoalesceEpsilon = 0.f;
+	FInputActionValue PendingValue;
+	FInputActionValue LastDeliveredValue;
+	float PendingElapsedSeconds = 0.f;
+	float PendingTriggeredSeconds = 0.f;
+	bool bHasPendingValue = false;
+	bool bHasDeliveredValue = false;
+
+	FEasyEIThrottleState Throttles[EasyEIBindings::NumTriggerEvents];
+
+	// Named binding sets gating each event, 0 for events that are always delivered
+	uint32 NamedSetMasks[EasyEIBindings::NumTriggerEvents] = {};
+
+	// Entry in the forwarded action table, INDEX_NONE when not forwarding
+	int32 ForwardIndex = INDEX_NONE;
+};
+
+/**
+ * Native member function registered for an action and event, bound through Enhanced Input's typed overloads.
+ */
+struct FEasyEINativeHandler
+{
+	TWeakObjectPtr<UObject> Object;
+	TFunction<FEnhancedInputActionEventBinding&(UEnhancedInputComponent&, const UInputAction*, ETriggerEvent)> Bind;
 };
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
@@ -52,11 +334,55 @@ class EASYEIBINDINGS_API UEasyEIBindingsComponent : public UActorComponent
 	GENERATED_BODY()
 
 public:
+	static constexpr int32 MaxNamedBindingSets = 32;
+
 	UEasyEIBindingsComponent();
 
+	// Shared bindings, resolved once per owner class for every component referencing the set
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Easy EI Bindings")
+	TObjectPtr<UEasyEIBindingSet> BindingSet;
+
+	// Per-instance bindings. An action listed here replaces the BindingSet entry for the same action.
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Easy EI Bindings")
 	TArray<FEasyEIBinding> InputBindings;
 
+	// Bound at setup alongside InputBindings, but only delivered while the set is active. Switching sets never rebinds.
+	// Actions in InputBindings or BindingSet stay delivered regardless of the active sets. At most 32 sets.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Easy EI Bindings", meta = (TitleProperty = "Name"))
+	TArray<FEasyEINamedBindingSet> NamedBindingSets;
+
+	// Added to the owner's local player while the bindings are set up. Context changes made in a frame
+	// are applied together from the next tick, so they cause a single control mapping rebuild.
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Easy EI Bindings|Mapping Contexts")
+	TArray<FEasyEIMappingContext> MappingContexts;
+
+	// Resolve handler names when the owner is saved or cooked, so setup binds from the baked table
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Easy EI Bindings")
+	bool bBakeBindingTable = false;
+
+	// Only bind actions mapped by the local player's active Input Mapping Contexts, following context changes
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Easy EI Bindings")
+	bool bBindMappedActionsOnly = false;
+
+	// On a pawn, stay dormant until a local player controller possesses it, bind once the pawn has restarted with its
+	// input component and release the bindings when it is unpossessed. Re-possession binds the events resolved for the previous possession.
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Easy EI Bindings")
+	bool bBindOnPossession = false;
+
+	// Route events through one native dispatcher per action that calls the owner's handlers directly,
+	// instead of binding every event to the owner by function name
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Easy EI Bindings")
+	bool bDispatchThroughComponent = false;
+
+	// On an autonomous client, also send every handled event to the server in one quantized packet per net update.
+	// The server calls the same handlers. The owner must be replicated and owned by the client's connection.
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Easy EI Bindings|Replication")
+	bool bForwardToServer = false;
+
+	// Record the time from raw input arrival to handler invocation per action. Uses component dispatch.
+	UPROPERTY(EditAnywhere, AdvancedDisplay, Category = "Easy EI Bindings|Debug")
+	bool bMeasureInputLatency = false;
+
 	UFUNCTION(BlueprintCallable, Category = "Easy EI Bindings")
 	virtual void SetupInputActions(UEnhancedInputComponent* EnhancedInputComponent = nullptr);
 
@@ -66,9 +392,386 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Easy EI Bindings")
 	virtual void ClearInputBindings();
 
+	/** Switches the shared binding set, rebinding only the events that differ when already set up. */
+	UFUNCTION(BlueprintCallable, Category = "Easy EI Bindings")
+	void SetBindingSet(UEasyEIBindingSet* NewBindingSet);
+
+	/**
+	 * Makes the named set the only active one, None deactivates every set. Only flips the mask checked on dispatch.
+	 * Events handled by native handlers are bound directly and are not affected.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy EI Bindings")
+	void ActivateNamedBindingSet(FName SetName);
+
+	UFUNCTION(BlueprintCallable, Category = "Easy EI Bindings")
+	void SetNamedBindingSetActive(FName SetName, bool bActive);
+
+	UFUNCTION(BlueprintPure, Category = "Easy EI Bindings")
+	bool IsNamedBindingSetActive(FName SetName) const;
+
+	/** Queues a context to add with the next batch, replacing its priority if this component already added it. */
+	UFUNCTION(BlueprintCallable, Category = "Easy EI Bindings|Mapping Contexts")
+	void AddMappingContext(UInputMappingContext* MappingContext, int32 Priority = 0);
+
+	/** Queues the removal of a context added by AddMappingContext. */
+	UFUNCTION(BlueprintCallable, Category = "Easy EI Bindings|Mapping Contexts")
+	void RemoveMappingContext(UInputMappingContext* MappingContext);
+
+	/** Applies the queued context changes now instead of from the next tick. */
+	UFUNCTION(BlueprintCallable, Category = "Easy EI Bindings|Mapping Contexts")
+	void FlushMappingContexts();
+
+	UFUNCTION(BlueprintPure, Category = "Easy EI Bindings|Debug")
+	FEasyEILatencyStats GetInputLatencyStats(const UInputAction* Action) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Easy EI Bindings|Debug")
+	void ResetInputLatencyStats();
+
+	/** Writes the latency percentiles of every measured action, see EasyEIBindings.DumpLatency. */
+	void DumpInputLatency(FOutputDevice& Ar) const;
+
+	/** Streams every dispatched event to the file until stopped. Switches the bindings to component dispatch. */
+	UFUNCTION(BlueprintCallable, Category = "Easy EI Bindings|Recording")
+	bool StartInputRecording(const FString& Filename);
+
+	UFUNCTION(BlueprintCallable, Category = "Easy EI Bindings|Recording")
+	void StopInputRecording();
+
+	/**
+	 * Feeds a recording into the handlers bound by SetupInputActions, one recorded frame per tick, ignoring live input.
+	 * Owners that were never set up, e.g. without a local player, have their handlers called directly.
+	 */
+	UFUNCTION(BlueprintCallable, Category = "Easy EI Bindings|Recording")
+	bool StartInputReplay(const FString& Filename);
+
+	UFUNCTION(BlueprintCallable, Category = "Easy EI Bindings|Recording")
+	void StopInputReplay();
+
+	UFUNCTION(BlueprintPure, Category = "Easy EI Bindings|Recording")
+	bool IsRecordingInput() const { return InputRecorder.IsValid(); }
+
+	UFUNCTION(BlueprintPure, Category = "Easy EI Bindings|Recording")
+	bool IsReplayingInput() const { return InputPlayer.IsValid(); }
+
+	UFUNCTION(BlueprintPure, Category = "Easy EI Bindings|Replication")
+	FEasyEIForwardingStats GetForwardingStats() const;
+
+	UFUNCTION(BlueprintCallable, Category = "Easy EI Bindings|Replication")
+	void ResetForwardingStats();
+
+	/** Writes the forwarding traffic, see EasyEIBindings.DumpForwarding. */
+	void DumpForwardingStats(FOutputDevice& Ar) const;
+
+	/** Number of events dropped or merged by the action's MaxDispatchRate since the last reset. */
+	UFUNCTION(BlueprintPure, Category = "Easy EI Bindings|Debug")
+	int32 GetThrottledEventCount(const UInputAction* Action) const;
+
+	UFUNCTION(BlueprintCallable, Category = "Easy EI Bindings|Debug")
+	void ResetThrottledEventCounts();
+
+	/** Writes the throttled event count of every rate limited action, see EasyEIBindings.DumpThrottling. */
+	void DumpThrottledEvents(FOutputDevice& Ar) const;
+
+	/**
+	 * Binds a native member function instead of the IA_<Name>_<Event> function for this action and event.
+	 * The event still has to be enabled in InputBindings. Register before setup, e.g. before Super::BeginPlay.
+	 */
+	template <class UserClass>
+	void BindNativeHandler(const UInputAction* Action, ETriggerEvent Event, UserClass* Object,
+	                       void (UserClass::*Func)(const FInputActionValue&))
+	{
+		AddNativeHandler(Action, Event, Object, Func);
+	}
+
+	template <class UserClass>
+	void BindNativeHandler(const UInputAction* Action, ETriggerEvent Event, UserClass* Object,
+	                       void (UserClass::*Func)(const FInputActionInstance&))
+	{
+		AddNativeHandler(Action, Event, Object, Func);
+	}
+
+	template <class UserClass>
+	void BindNativeHandler(const UInputAction* Action, ETriggerEvent Event, UserClass* Object,
+	                       void (UserClass::*Func)())
+	{
+		AddNativeHandler(Action, Event, Object, Func);
+	}
+
+	void RemoveNativeHandler(const UInputAction* Action, ETriggerEvent Event);
+
+	void RemoveNativeHandlers(const UObject* Object);
+
+	virtual void PostInitProperties() override;
+	virtual void PostLoad() override;
+
+#if WITH_EDITOR
+	virtual void PreSave(FObjectPreSaveContext SaveContext) override;
+
+	/**
+	 * Appends one EasyEIBindings tag entry per binding, without loading soft actions. OwnerClass defaults to the class the
+	 * component lives in; pass the child class for templates inherited from a parent Blueprint. Empty when it is unknown.
+	 */
+	void AppendBindingTagEntries(TArray<FString>& OutEntries, const UClass* OwnerClass = nullptr) const;
+#endif
+
 protected:
 	virtual void BeginPlay() override;
 
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
+
+	virtual void TickComponent(float DeltaTime, ELevelTick TickType,
+	                           FActorComponentTickFunction* ThisTickFunction) override;
+
+	UEnhancedInputLocalPlayerSubsystem* GetEnhancedInputSubsystem() const;
+
 private:
-	TArray<uint32> BoundActionHandles;
+	template <class UserClass, typename FuncType>
+	void AddNativeHandler(const UInputAction* Action, ETriggerEvent Event, UserClass* Object, FuncType Func)
+	{
+		FEasyEINativeHandler Handler;
+		Handler.Object = Object;
+		Handler.Bind = [Object, Func](UEnhancedInputComponent& InputComponent, const UInputAction* InAction,
+		                              ETriggerEvent InEvent) -> FEnhancedInputActionEventBinding&
+		{
+			return InputComponent.BindAction(InAction, InEvent, Object, Func);
+		};
+		RegisterNativeHandler(Action, Event, MoveTemp(Handler));
+	}
+
+	void RegisterNativeHandler(const UInputAction* Action, ETriggerEvent Event, FEasyEINativeHandler&& Handler);
+
+	const FEasyEINativeHandler* FindNativeHandler(const UInputAction* Action, ETriggerEvent Event) const;
+
+	const FEasyEIBakedBinding* FindBakedBinding(int32 BindingIndex, const UClass* OwnerClass) const;
+
+	/** Collects the handler every enabled (action, event) pair should be bound to. */
+	void GatherDesiredEvents(const AActor* Owner, TMap<FEasyEIBindingKey, FEasyEIBoundEvent>& OutEvents) const;
+
+	/** NamedSetMask gates the events to named binding sets, events already gathered ungated stay ungated. */
+	void GatherActionEvents(const FEasyEIBinding& Binding, const UInputAction* Action, uint8 EnabledEventSlots,
+	                        const FEasyEIResolvedAction& Resolved,
+	                        TMap<FEasyEIBindingKey, FEasyEIBoundEvent>& OutEvents, uint32 NamedSetMask = 0) const;
+
+	bool OverridesAction(const UInputAction* Action) const;
+
+	bool BindEvent(UEnhancedInputComponent& EnhancedInputComponent, AActor* Owner, const FEasyEIBindingKey& Key,
+	               FEasyEIBoundEvent& InOutEvent);
+
+	void ReleaseEvent(UEnhancedInputComponent* EnhancedInputComponent, const FEasyEIBindingKey& Key,
+	                  const FEasyEIBoundEvent& BoundEvent);
+
+	void UnbindEvent(const FEasyEIBindingKey& Key);
+
+	int32 FindNamedBindingSet(FName SetName) const;
+
+	/** Applies bActiveByDefault the first time the active sets are read or changed. */
+	void InitializeActiveNamedSets();
+
+	bool IsDispatchedEventActive(const FEasyEIDispatchSlot& Slot, int32 EventIndex) const
+	{
+		return Slot.NamedSetMasks[EventIndex] == 0 || (Slot.NamedSetMasks[EventIndex] & ActiveNamedSetMask) != 0;
+	}
+
+	/** Whether reflected handlers are invoked by DispatchActionEvent rather than bound by name. */
+	bool UsesComponentDispatch() const;
+
+	void DispatchActionEvent(const FInputActionInstance& Instance, int32 SlotIndex, int32 EventIndex);
+
+	/** Applies the event's rate limit, then delivers it. */
+	void InvokeHandler(FEasyEIDispatchSlot& Slot, int32 EventIndex, const FInputActionValue& Value,
+	                   float ElapsedSeconds, float TriggeredSeconds);
+
+	void DeliverToHandler(FEasyEIDispatchSlot& Slot, int32 EventIndex, const FInputActionValue& Value,
+	                      float ElapsedSeconds, float TriggeredSeconds);
+
+	/** Calls the owner's handler found through the binding cache, for events that have no dispatch slot. */
+	void InvokeUnboundHandler(const UInputAction* Action, int32 EventIndex, const FInputActionValue& Value);
+
+	void AdvanceInputReplay();
+
+	/** Delivers the Triggered values combined this frame, one call per coalescing action. */
+	void FlushCoalescedValues();
+
+	void FlushCoalescedValue(FEasyEIDispatchSlot& Slot);
+
+	/** Delivers merged over-rate events whose interval has passed. */
+	void FlushMergedEvents();
+
+	/** Whether handled events are sent to the server, true on autonomous proxies with bForwardToServer set. */
+	bool ShouldForwardToServer() const;
+
+	/** Lists the actions of InputBindings, BindingSet and NamedBindingSets in an order client and server agree on. */
+	void BuildForwardedActions();
+
+	int32 FindForwardedAction(const UInputAction* Action) const;
+
+	void RecordForwardedEvent(const FEasyEIDispatchSlot& Slot, int32 EventIndex, const FInputActionValue& Value);
+
+	void FlushForwardedInput();
+
+	/** Whether the owner's net update interval has passed since the last forwarded packet. */
+	bool ShouldFlushForwardedInput() const;
+
+	UFUNCTION(Server, Unreliable)
+	void ServerForwardInput(const FEasyEIForwardedInput& Packet);
+
+	void UpdateDispatchTick();
+
+	void RecordInputLatency(FEasyEIDispatchSlot& Slot);
+
+	/**
+	 * Holds load handles for every soft action of the binding set, InputBindings and NamedBindingSets.
+	 * Returns false while loads are in flight, setup or rebind then resumes from HandleInputActionsLoaded.
+	 */
+	bool AcquireInputActions();
+
+	bool HaveInputActionsLoaded() const;
+
+	void HandleInputActionsLoaded();
+
+	void StopWaitingForInputActions();
+
+	void ReleaseInputActions();
+
+	/** Contexts that should be applied: MappingContexts, those of active named sets and runtime additions. */
+	void GatherDesiredMappingContexts(TMap<UInputMappingContext*, int32>& OutContexts) const;
+
+	bool HaveMappingContexts(uint32 NamedSetMask) const;
+
+	void MarkMappingContextsDirty();
+
+	/** Removes every context this component applied, from the subsystem it applied them to. */
+	void ReleaseMappingContexts();
+
+	/** Mapping changes matter to bBindMappedActionsOnly and to the keys bMeasureInputLatency reads stamps from. */
+	bool ShouldWatchMappingContexts() const;
+	void WatchMappingContexts();
+	void StopWatchingMappingContexts();
+	void RefreshMappedActions();
+
+	/** False when bBindMappedActionsOnly is set and no active context maps the action. */
+	bool IsActionMapped(const UInputAction* Action) const;
+
+	UFUNCTION()
+	void HandleControlMappingsRebuilt();
+
+	UFUNCTION()
+	void HandleControllerChanged(APawn* Pawn, AController* OldController, AController* NewController);
+
+	/** Fires after the pawn's input component is created for its controller. */
+	UFUNCTION()
+	void HandlePawnRestarted(APawn* Pawn);
+
+	bool IsPossessedByLocalPlayer() const;
+
+	void SchedulePossessionUpdate();
+	void CancelPossessionUpdate();
+
+	/** Binds or releases to match the owner's controller, retried for a few ticks until the input component exists. */
+	void UpdatePossession();
+
+	/** Releases the bindings, keeping the gathered events for the next possession. */
+	void EnterDormancy();
+
+	/** Moves the events kept by EnterDormancy into BoundEvents, false when they are out of date. */
+	bool TakeDormantEvents();
+
+	/** Hash of everything GatherDesiredEvents reads besides the binding cache. */
+	uint32 GetBindingsSignature() const;
+
+#if WITH_EDITOR
+	void BakeBindingTable();
+
+	/** Class expected to implement the handlers: the Blueprint class for templates, otherwise the outer actor's class. */
+	UClass* GetOuterOwnerClass() const;
+#endif
+
+	UPROPERTY()
+	TArray<FEasyEIBakedBinding> BakedBindings;
+
+	UPROPERTY()
+	TObjectPtr<UClass> BakedOwnerClass = nullptr;
+
+	TMap<FEasyEIBindingKey, FEasyEINativeHandler> NativeHandlers;
+
+	TWeakObjectPtr<UEnhancedInputComponent> BoundInputComponent;
+
+	// Subsystem observed for mapping changes while bBindMappedActionsOnly or bMeasureInputLatency is set
+	TWeakObjectPtr<UEnhancedInputLocalPlayerSubsystem> WatchedInputSubsystem;
+
+	TSet<const UInputAction*> MappedActions;
+
+	TMap<FEasyEIBindingKey, FEasyEIBoundEvent> BoundEvents;
+
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UInputMappingContext>, int32> AddedMappingContexts;
+
+	// Contexts currently added to MappingContextSubsystem, with their priorities
+	UPROPERTY(Transient)
+	TMap<TObjectPtr<UInputMappingContext>, int32> AppliedMappingContexts;
+
+	TWeakObjectPtr<UEnhancedInputLocalPlayerSubsystem> MappingContextSubsystem;
+
+	bool bMappingContextsDirty = false;
+
+	// Bit N set while NamedBindingSets[N] is active
+	uint32 ActiveNamedSetMask = 0;
+	bool bActiveNamedSetsInitialized = false;
+
+	// Slots keep their index while bound, since dispatch bindings capture it
+	TArray<FEasyEIDispatchSlot> DispatchSlots;
+	TMap<const UInputAction*, int32> DispatchSlotIndices;
+
+	TMap<TObjectKey<UInputAction>, FEasyEILatencyHistogram> LatencyHistograms;
+
+	TMap<TObjectKey<UInputAction>, int32> ThrottledEventCounts;
+
+	TArray<FEasyEIForwardedAction> ForwardedActions;
+
+	// Identifies ForwardedActions in packets, see FEasyEIForwardedInput::TableHash
+	uint32 ForwardedTableHash = 0;
+
+	double LastForwardFlushSeconds = 0.0;
+
+	// Client table hash last dropped by the server, so a mismatch only rebuilds and reports once
+	uint32 RejectedTableHash = 0;
+
+	// Events handled this frame, sent from the tick
+	FEasyEIForwardedInput PendingForwardedInput;
+
+	TUniquePtr<FEasyEIInputRecorder> InputRecorder;
+	TUniquePtr<FEasyEIInputPlayer> InputPlayer;
+	uint64 ReplayFrameOffset = 0;
+
+	FEasyEIForwardingStats ForwardingStats;
+	int64 ForwardedBitsSent = 0;
+	int64 ForwardedBitsReceived = 0;
+
+	// Shared with every component using the same set, the actions stay loaded while any of them holds it
+	TSharedPtr<FStreamableHandle> BindingSetLoadHandle;
+
+	// Soft actions of InputBindings and NamedBindingSets and the paths the handle was requested for
+	TSharedPtr<FStreamableHandle> InputBindingsLoadHandle;
+	TArray<FSoftObjectPath> InputBindingsLoadPaths;
+
+	// Input component setup resumes with once the soft actions have loaded
+	TWeakObjectPtr<UEnhancedInputComponent> PendingInputComponent;
+
+	bool bWaitingForInputActions = false;
+
+	// Set while waiting in the setup subsystem's queue
+	bool bSetupQueued = false;
+
+	// Events bound during the last possession, with the signature and cache generation they were gathered for
+	TMap<FEasyEIBindingKey, FEasyEIBoundEvent> DormantEvents;
+	uint32 DormantSignature = 0;
+	uint32 DormantCacheGeneration = 0;
+
+	// Next-tick UpdatePossession, cleared on dormancy and EndPlay
+	FTimerHandle PossessionUpdateTimer;
+
+	// Ticks spent possessed without an input component since the last controller change
+	int32 PossessionRetries = 0;
+
+	friend class UEasyEIBindingsSetupSubsystem;
 };
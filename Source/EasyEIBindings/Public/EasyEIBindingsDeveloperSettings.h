@@ -34,4 +34,8 @@ public:
 
 	UPROPERTY(Config, EditAnywhere, Category = "Editor")
 	bool bShowBindingStatus;
+
+	// Show InputBindings as a filterable, virtualized table once a component has at least this many bindings. 0 disables the table.
+	UPROPERTY(Config, EditAnywhere, Category = "Editor", meta = (ClampMin = "0"))
+	int32 BindingTableThreshold;
 };
@@ -0,0 +1,97 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputActionValue.h"
+#include "UObject/SoftObjectPath.h"
+#include "EasyEIBindingsForwarding.generated.h"
+
+/**
+ * One action event forwarded from a client to the server.
+ */
+struct FEasyEIForwardedEvent
+{
+	// Index into the component's forwarded action table, which client and server build from the same bindings
+	uint16 ActionIndex = 0;
+	uint8 EventIndex = 0;
+	FInputActionValue Value;
+};
+
+/**
+ * Every event forwarded since the client's last net update. Axis values are quantized to ValueResolution and
+ * written as variable-length integers, booleans as a single bit.
+ */
+USTRUCT()
+struct EASYEIBINDINGS_API FEasyEIForwardedInput
+{
+	GENERATED_BODY()
+
+	static constexpr float ValueResolution = 0.001f;
+	static constexpr int32 MaxEvents = 1024;
+
+	// Hash of the client's forwarded action table, the server drops packets built against a different table
+	uint32 TableHash = 0;
+
+	TArray<FEasyEIForwardedEvent> Events;
+
+	bool NetSerialize(FArchive& Ar, UPackageMap* Map, bool& bOutSuccess);
+
+	/** Size of the packet as written to the network. */
+	int64 GetNumBits() const;
+};
+
+template <>
+struct TStructOpsTypeTraits<FEasyEIForwardedInput> : public TStructOpsTypeTraitsBase2<FEasyEIForwardedInput>
+{
+	enum
+	{
+		WithNetSerializer = true
+	};
+};
+
+/**
+ * Entry of the forwarded action table.
+ */
+struct FEasyEIForwardedAction
+{
+	FSoftObjectPath Action;
+
+	// Events the bindings enable, the server rejects any other
+	uint8 EnabledEventSlots = 0;
+};
+
+/**
+ * Traffic of a component forwarding input to the server, counted on the side it was sent or received.
+ */
+USTRUCT(BlueprintType)
+struct FEasyEIForwardingStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Forwarding")
+	int32 PacketsSent = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Forwarding")
+	int32 EventsSent = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Forwarding")
+	int64 BytesSent = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Forwarding")
+	int32 PacketsReceived = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Forwarding")
+	int32 EventsReceived = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Forwarding")
+	int64 BytesReceived = 0;
+
+	// Received events for unknown actions or events the bindings do not enable
+	UPROPERTY(BlueprintReadOnly, Category = "Forwarding")
+	int32 EventsRejected = 0;
+
+	// Received packets dropped because the client's action table differs from the server's
+	UPROPERTY(BlueprintReadOnly, Category = "Forwarding")
+	int32 PacketsRejected = 0;
+};
@@ -0,0 +1,62 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EasyEIBindingsLatency.generated.h"
+
+/**
+ * Input-to-handler latency percentiles for one Input Action.
+ */
+USTRUCT(BlueprintType)
+struct FEasyEILatencyStats
+{
+	GENERATED_BODY()
+
+	UPROPERTY(BlueprintReadOnly, Category = "Latency")
+	int32 SampleCount = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Latency")
+	float P50Microseconds = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Latency")
+	float P95Microseconds = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Latency")
+	float P99Microseconds = 0.f;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Latency")
+	int32 P50Frames = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Latency")
+	int32 P95Frames = 0;
+
+	UPROPERTY(BlueprintReadOnly, Category = "Latency")
+	int32 P99Frames = 0;
+};
+
+/**
+ * Fixed-size latency histogram. Microseconds use four buckets per power of two,
+ * so percentiles are reported as bucket upper bounds within about 19%.
+ */
+struct EASYEIBINDINGS_API FEasyEILatencyHistogram
+{
+	static constexpr int32 NumMicrosecondBuckets = 96;
+	static constexpr int32 NumFrameBuckets = 64;
+
+	void AddSample(double Microseconds, uint64 Frames);
+
+	FEasyEILatencyStats GetStats() const;
+
+	void Reset();
+
+private:
+	static int32 GetMicrosecondBucket(double Microseconds);
+	static double GetMicrosecondBucketUpperBound(int32 Bucket);
+
+	int32 FindPercentileBucket(const uint32* Buckets, int32 NumBuckets, float Percentile) const;
+
+	uint32 MicrosecondBuckets[NumMicrosecondBuckets] = {};
+	uint32 FrameBuckets[NumFrameBuckets] = {};
+	int32 SampleCount = 0;
+};
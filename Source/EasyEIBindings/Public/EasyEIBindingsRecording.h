@@ -0,0 +1,123 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "InputActionValue.h"
+#include "UObject/ObjectKey.h"
+
+class UInputAction;
+struct FStreamableHandle;
+
+/**
+ * One dispatched event as stored in an input recording.
+ */
+struct FEasyEIRecordedEvent
+{
+	const UInputAction* Action = nullptr;
+	int32 EventIndex = 0;
+	FInputActionValue Value;
+
+	// Engine frame and microseconds since the recording started
+	uint64 Frame = 0;
+	uint64 Microseconds = 0;
+};
+
+/**
+ * Writes dispatched events to a recording file in fixed-size chunks, so memory stays flat however long it runs.
+ *
+ * Layout: a magic and version, then chunks of [payload size, event count, base frame, base time, payload].
+ * Each event stores its frame and time as deltas from the previous event, the action as an index into a table
+ * built inline the first time an action appears, and each value component XORed with the action's previous value.
+ */
+class EASYEIBINDINGS_API FEasyEIInputRecorder
+{
+public:
+	/** Opens the file for writing, null if it cannot be created. */
+	static TUniquePtr<FEasyEIInputRecorder> Create(const FString& Filename);
+
+	~FEasyEIInputRecorder();
+
+	void Record(const UInputAction* Action, int32 EventIndex, const FInputActionValue& Value);
+
+	/** Writes the pending chunk and closes the file. */
+	void Close();
+
+	int64 GetNumEvents() const { return NumEvents; }
+	int64 GetNumBytesWritten() const;
+
+private:
+	explicit FEasyEIInputRecorder(TUniquePtr<FArchive>&& InFileWriter);
+
+	void FlushChunk();
+
+	TUniquePtr<FArchive> FileWriter;
+
+	TArray<uint8> ChunkData;
+	int32 ChunkNumEvents = 0;
+	uint64 ChunkBaseFrame = 0;
+	uint64 ChunkBaseMicroseconds = 0;
+
+	uint64 StartFrame = 0;
+	uint64 StartCycles = 0;
+	uint64 PreviousFrame = 0;
+	uint64 PreviousMicroseconds = 0;
+
+	TMap<FObjectKey, uint32> ActionIndices;
+
+	// Last value written per action index, the base for XOR deltas
+	TArray<FVector3f> PreviousValues;
+
+	int64 NumEvents = 0;
+};
+
+/**
+ * Streams a recording back one chunk at a time. Every action the recording uses is loaded when it is opened.
+ */
+class EASYEIBINDINGS_API FEasyEIInputPlayer
+{
+public:
+	/** Opens the file for reading, null if it is missing or not a recording. */
+	static TUniquePtr<FEasyEIInputPlayer> Open(const FString& Filename);
+
+	/**
+	 * Calls Func for every event recorded up to FrameOffset frames after the first one, in recorded order.
+	 * Returns false once the recording is exhausted.
+	 */
+	bool Advance(uint64 FrameOffset, TFunctionRef<void(const FEasyEIRecordedEvent&)> Func);
+
+private:
+	explicit FEasyEIInputPlayer(TUniquePtr<FArchive>&& InFileReader);
+
+	/** Opens the file and checks its header, null if it is missing or not a recording. */
+	static TUniquePtr<FArchive> OpenReader(const FString& Filename);
+
+	void PreloadActions(const FString& Filename);
+
+	bool ReadEvent(FEasyEIRecordedEvent& OutEvent);
+	bool ReadChunk();
+
+	TUniquePtr<FArchive> FileReader;
+
+	TArray<uint8> ChunkData;
+	int64 ChunkOffset = 0;
+	int32 ChunkEventsLeft = 0;
+	uint64 PreviousFrame = 0;
+	uint64 PreviousMicroseconds = 0;
+
+	// Table defined so far by the events read
+	TArray<FString> ActionPaths;
+
+	// Loaded from the whole table on open, null for actions that no longer exist
+	TArray<TWeakObjectPtr<UInputAction>> Actions;
+
+	// Keeps Actions loaded for the player's lifetime, including actions no binding references
+	TSharedPtr<FStreamableHandle> ActionsLoadHandle;
+	TArray<FVector3f> PreviousValues;
+
+	FEasyEIRecordedEvent NextEvent;
+	bool bHasNextEvent = false;
+
+	uint64 FirstFrame = 0;
+	bool bStarted = false;
+};
@@ -0,0 +1,30 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DeveloperSettings.h"
+#include "EasyEIBindingsRuntimeSettings.generated.h"
+
+/**
+ * Runtime settings for EasyEI Bindings, saved to DefaultGame.ini so packaged builds read them.
+ */
+UCLASS(Config=Game, DefaultConfig, meta=(DisplayName="Easy EI Bindings Runtime"))
+class EASYEIBINDINGS_API UEasyEIBindingsRuntimeSettings : public UDeveloperSettings
+{
+	GENERATED_BODY()
+
+public:
+	UEasyEIBindingsRuntimeSettings();
+
+	static const UEasyEIBindingsRuntimeSettings* Get();
+
+	// Queue BeginPlay setups in a world subsystem and spread them over frames instead of binding immediately
+	UPROPERTY(Config, EditAnywhere, Category = "Setup")
+	bool bTimeSliceSetup;
+
+	// Time each frame may spend processing queued setups, in milliseconds
+	UPROPERTY(Config, EditAnywhere, Category = "Setup",
+		meta = (ClampMin = "0.01", Units = "ms", EditCondition = "bTimeSliceSetup"))
+	float SetupTimeBudgetMs;
+};
@@ -0,0 +1,58 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "EasyEIBindingsSetupSubsystem.generated.h"
+
+class AController;
+class APawn;
+class UEasyEIBindingsComponent;
+
+/**
+ * Spreads SetupInputActions calls queued from BeginPlay over several frames,
+ * so that streaming in many components at once does not hitch a single frame.
+ * Player-controlled owners are processed before everything else, including pawns possessed while queued.
+ */
+UCLASS()
+class EASYEIBINDINGS_API UEasyEIBindingsSetupSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	void EnqueueSetup(UEasyEIBindingsComponent* Component);
+
+	UFUNCTION(BlueprintPure, Category = "Easy EI Bindings")
+	int32 GetQueueDepth() const;
+
+	UFUNCTION(BlueprintPure, Category = "Easy EI Bindings")
+	int32 GetBudgetOverrunCount() const { return BudgetOverrunCount; }
+
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+protected:
+	virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+	UFUNCTION()
+	void HandlePawnControllerChanged(APawn* Pawn, AController* Controller);
+
+	struct FSetupQueue
+	{
+		TArray<TWeakObjectPtr<UEasyEIBindingsComponent>> Entries;
+		int32 Head = 0;
+
+		int32 Num() const { return Entries.Num() - Head; }
+		bool Pop(TWeakObjectPtr<UEasyEIBindingsComponent>& OutEntry);
+	};
+
+	FSetupQueue PlayerQueue;
+	FSetupQueue DeferredQueue;
+
+	int32 BudgetOverrunCount = 0;
+};
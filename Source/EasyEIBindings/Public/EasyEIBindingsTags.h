@@ -0,0 +1,45 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace EasyEIBindings
+{
+	/** Asset registry tag listing every binding of the asset's components, as FEasyEIBindingTagEntry entries. */
+	EASYEIBINDINGS_API extern const FName BindingsTag;
+
+	/** Asset registry tag listing the IA_ handlers a Blueprint class implements, separated by commas. */
+	EASYEIBINDINGS_API extern const FName HandlersTag;
+
+	/** Asset registry tag every Blueprint saved with the plugin carries, so Blueprints saved before it can be told apart. */
+	EASYEIBINDINGS_API extern const FName TaggedBlueprintTag;
+}
+
+/**
+ * One binding as exported to the asset registry: the class expected to implement its handlers,
+ * the action, the enabled event slots and the handler names, so that bindings can be checked
+ * without loading the asset.
+ *
+ * Serialized as OwnerClassPath|ActionPath|EventSlots|Handler+Handler, entries separated by ';'.
+ */
+struct EASYEIBINDINGS_API FEasyEIBindingTagEntry
+{
+	FString OwnerClassPath;
+	FString ActionPath;
+
+	// Bit N set when event slot N is enabled
+	uint8 EnabledEventSlots = 0;
+
+	// Handlers of the enabled event slots
+	TArray<FName> HandlerNames;
+
+	FString ToString() const;
+
+	static bool Parse(const FString& Text, FEasyEIBindingTagEntry& OutEntry);
+
+	/** Parses a whole tag value, skipping malformed entries. */
+	static TArray<FEasyEIBindingTagEntry> ParseList(const FString& TagValue);
+
+	static FString JoinList(TConstArrayView<FString> Entries);
+};
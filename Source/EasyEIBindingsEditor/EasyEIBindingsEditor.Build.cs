@@ -33,7 +33,10 @@ public class EasyEIBindingsEditor : ModuleRules
                 "Kismet",
                 "GraphEditor",
                 "InputBlueprintNodes",
-                "InputBlueprintNodes"
+                "InputBlueprintNodes",
+                "Projects",
+                "AssetRegistry",
+                "DataValidation"
             }
         );
     }
@@ -0,0 +1,248 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+
+#include "EasyEIBindingsBenchmarkCommandlet.h"
+
+#include "EasyEIBindingsComponent.h"
+#include "EnhancedInputComponent.h"
+#include "InputAction.h"
+#include "Engine/World.h"
+#include "HAL/PlatformFileManager.h"
+#include "Interfaces/IPluginManager.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "UObject/Package.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogEasyEIBindingsBenchmark, Log, All);
+
+namespace EasyEIBindingsBenchmark
+{
+	struct FResult
+	{
+		FString Phase;
+		int32 ItemsPerRun = 0;
+		TArray<double> Milliseconds;
+
+		double Min() const { return FMath::Min(Milliseconds); }
+		double Max() const { return FMath::Max(Milliseconds); }
+
+		double Mean() const
+		{
+			double Total = 0.0;
+			for (double Value : Milliseconds)
+			{
+				Total += Value;
+			}
+			return Milliseconds.Num() > 0 ? Total / Milliseconds.Num() : 0.0;
+		}
+
+		double MeanMicrosecondsPerItem() const
+		{
+			return ItemsPerRun > 0 ? Mean() * 1000.0 / ItemsPerRun : 0.0;
+		}
+	};
+
+	template <typename FuncType>
+	static double TimeMilliseconds(FuncType&& Func)
+	{
+		const double StartTime = FPlatformTime::Seconds();
+		Func();
+		return (FPlatformTime::Seconds() - StartTime) * 1000.0;
+	}
+
+	static FString ToCsv(const TArray<FResult>& Results, const FString& Version, int32 NumActors, int32 NumActions, bool bDispatch)
+	{
+		FString Csv = TEXT("version,mode,actors,actions,phase,runs,items_per_run,mean_ms,min_ms,max_ms,mean_us_per_item\n");
+		for (const FResult& Result : Results)
+		{
+			Csv += FString::Printf(TEXT("%s,%s,%d,%d,%s,%d,%d,%.4f,%.4f,%.4f,%.4f\n"),
+			                       *Version, bDispatch ? TEXT("dispatch") : TEXT("by_name"), NumActors, NumActions,
+			                       *Result.Phase, Result.Milliseconds.Num(), Result.ItemsPerRun, Result.Mean(),
+			                       Result.Min(), Result.Max(), Result.MeanMicrosecondsPerItem());
+		}
+		return Csv;
+	}
+
+	static FString ToJson(const TArray<FResult>& Results, const FString& Version, int32 NumActors, int32 NumActions, bool bDispatch)
+	{
+		TArray<FString> Entries;
+		for (const FResult& Result : Results)
+		{
+			Entries.Add(FString::Printf(
+				TEXT("\t\t{ \"phase\": \"%s\", \"runs\": %d, \"items_per_run\": %d, \"mean_ms\": %.4f, \"min_ms\": %.4f, \"max_ms\": %.4f, \"mean_us_per_item\": %.4f }"),
+				*Result.Phase, Result.Milliseconds.Num(), Result.ItemsPerRun, Result.Mean(), Result.Min(), Result.Max(),
+				Result.MeanMicrosecondsPerItem()));
+		}
+
+		return FString::Printf(
+			TEXT("{\n\t\"version\": \"%s\",\n\t\"mode\": \"%s\",\n\t\"actors\": %d,\n\t\"actions\": %d,\n\t\"results\": [\n%s\n\t]\n}\n"),
+			*Version, bDispatch ? TEXT("dispatch") : TEXT("by_name"), NumActors, NumActions,
+			*FString::Join(Entries, TEXT(",\n")));
+	}
+}
+
+UEasyEIBindingsBenchmarkCommandlet::UEasyEIBindingsBenchmarkCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UEasyEIBindingsBenchmarkCommandlet::Main(const FString& Params)
+{
+	using namespace EasyEIBindingsBenchmark;
+
+	int32 NumActors = 100;
+	int32 NumActions = 16;
+	int32 NumIterations = 5;
+	int32 NumDispatches = 10;
+	FString OutputDir = FPaths::ProjectSavedDir() / TEXT("EasyEIBindings") / TEXT("Benchmark");
+
+	FParse::Value(*Params, TEXT("Actors="), NumActors);
+	FParse::Value(*Params, TEXT("Actions="), NumActions);
+	FParse::Value(*Params, TEXT("Iterations="), NumIterations);
+	FParse::Value(*Params, TEXT("Dispatches="), NumDispatches);
+	FParse::Value(*Params, TEXT("Output="), OutputDir);
+	const bool bDispatch = FParse::Param(*Params, TEXT("Dispatch"));
+
+	NumActors = FMath::Clamp(NumActors, 1, 10000);
+	NumActions = FMath::Clamp(NumActions, 1, 256);
+	NumIterations = FMath::Max(NumIterations, 1);
+	NumDispatches = FMath::Max(NumDispatches, 1);
+
+	const TSharedPtr<IPlugin> Plugin = IPluginManager::Get().FindPlugin(TEXT("EasyEIBindings"));
+	const FString Version = Plugin.IsValid() ? Plugin->GetDescriptor().VersionName : TEXT("unknown");
+
+	UE_LOG(LogEasyEIBindingsBenchmark, Display, TEXT("Benchmarking %d actor(s) x %d action(s), %d iteration(s), %s."),
+	       NumActors, NumActions, NumIterations, bDispatch ? TEXT("component dispatch") : TEXT("by-name binding"));
+
+	// Every action shares the IA_Bench name, each in its own package, so one set of handlers resolves them all
+	TArray<UInputAction*> Actions;
+	for (int32 ActionIndex = 0; ActionIndex < NumActions; ++ActionIndex)
+	{
+		UPackage* Package = CreatePackage(*FString::Printf(TEXT("/Temp/EasyEIBindingsBenchmark/Action%d"), ActionIndex));
+		Package->SetFlags(RF_Transient);
+		UInputAction* Action = NewObject<UInputAction>(Package, TEXT("IA_Bench"), RF_Transient);
+		Action->AddToRoot();
+		Actions.Add(Action);
+	}
+
+	UWorld* World = UWorld::CreateWorld(EWorldType::Game, false, TEXT("EasyEIBindingsBenchmark"));
+	World->AddToRoot();
+
+	TArray<UEasyEIBindingsComponent*> Components;
+	TArray<UEnhancedInputComponent*> InputComponents;
+	for (int32 ActorIndex = 0; ActorIndex < NumActors; ++ActorIndex)
+	{
+		AEasyEIBindingsBenchmarkActor* Actor = World->SpawnActor<AEasyEIBindingsBenchmarkActor>();
+		UEnhancedInputComponent* InputComponent = NewObject<UEnhancedInputComponent>(Actor);
+		Actor->InputComponent = InputComponent;
+
+		UEasyEIBindingsComponent* Component = NewObject<UEasyEIBindingsComponent>(Actor);
+		Component->bDispatchThroughComponent = bDispatch;
+		for (UInputAction* Action : Actions)
+		{
+			FEasyEIBinding& Binding = Component->InputBindings.AddDefaulted_GetRef();
+			Binding.InputAction = Action;
+			Binding.SetEventEnabled(ETriggerEvent::Triggered, true);
+			Binding.SetEventEnabled(ETriggerEvent::Started, true);
+			Binding.SetEventEnabled(ETriggerEvent::Completed, true);
+		}
+
+		Components.Add(Component);
+		InputComponents.Add(InputComponent);
+	}
+
+	const int32 NumBindings = NumActors * NumActions;
+	FResult Setup{TEXT("SetupInputActions"), NumBindings};
+	FResult Rebind{TEXT("RebindInputActions"), NumActors};
+	FResult Dispatch{TEXT("Dispatch"), 0};
+	FResult Clear{TEXT("ClearInputBindings"), NumBindings};
+
+	TMap<const UInputAction*, FInputActionInstance> Instances;
+	for (const UInputAction* Action : Actions)
+	{
+		Instances.Add(Action, FInputActionInstance(Action));
+	}
+
+	for (int32 Iteration = 0; Iteration < NumIterations; ++Iteration)
+	{
+		Setup.Milliseconds.Add(TimeMilliseconds([&Components]()
+		{
+			for (UEasyEIBindingsComponent* Component : Components)
+			{
+				Component->SetupInputActions();
+			}
+		}));
+
+		// Synthetic injection straight into the bound Enhanced Input delegates
+		int32 NumExecuted = 0;
+		Dispatch.Milliseconds.Add(TimeMilliseconds([&InputComponents, &Instances, &NumExecuted, NumDispatches]()
+		{
+			for (int32 Round = 0; Round < NumDispatches; ++Round)
+			{
+				for (const UEnhancedInputComponent* InputComponent : InputComponents)
+				{
+					for (const TUniquePtr<FEnhancedInputActionEventBinding>& Binding : InputComponent->GetActionEventBindings())
+					{
+						Binding->Execute(Instances.FindChecked(Binding->GetAction()));
+						++NumExecuted;
+					}
+				}
+			}
+		}));
+		Dispatch.ItemsPerRun = NumExecuted;
+
+		// A one-event change per actor, the common weapon swap case
+		Rebind.Milliseconds.Add(TimeMilliseconds([&Components]()
+		{
+			for (UEasyEIBindingsComponent* Component : Components)
+			{
+				FEasyEIBinding& Binding = Component->InputBindings[0];
+				Binding.SetEventEnabled(ETriggerEvent::Ongoing, !Binding.IsEventEnabled(ETriggerEvent::Ongoing));
+				Component->RebindInputActions();
+			}
+		}));
+
+		Clear.Milliseconds.Add(TimeMilliseconds([&Components]()
+		{
+			for (UEasyEIBindingsComponent* Component : Components)
+			{
+				Component->ClearInputBindings();
+			}
+		}));
+	}
+
+	const TArray<FResult> Results = {Setup, Rebind, Dispatch, Clear};
+	for (const FResult& Result : Results)
+	{
+		UE_LOG(LogEasyEIBindingsBenchmark, Display, TEXT("%-20s mean %9.3f ms  min %9.3f ms  max %9.3f ms  %8.3f us/item"),
+		       *Result.Phase, Result.Mean(), Result.Min(), Result.Max(), Result.MeanMicrosecondsPerItem());
+	}
+
+	const FString BaseName = FString::Printf(TEXT("EasyEIBindings_%s_%dx%d_%s"), *Version, NumActors, NumActions,
+	                                         bDispatch ? TEXT("dispatch") : TEXT("by_name"));
+	const FString CsvPath = OutputDir / BaseName + TEXT(".csv");
+	const FString JsonPath = OutputDir / BaseName + TEXT(".json");
+
+	FPlatformFileManager::Get().GetPlatformFile().CreateDirectoryTree(*OutputDir);
+	const bool bSaved = FFileHelper::SaveStringToFile(ToCsv(Results, Version, NumActors, NumActions, bDispatch), *CsvPath)
+		&& FFileHelper::SaveStringToFile(ToJson(Results, Version, NumActors, NumActions, bDispatch), *JsonPath);
+
+	World->RemoveFromRoot();
+	World->DestroyWorld(false);
+	for (UInputAction* Action : Actions)
+	{
+		Action->RemoveFromRoot();
+	}
+
+	if (!bSaved)
+	{
+		UE_LOG(LogEasyEIBindingsBenchmark, Error, TEXT("Failed to write results to %s."), *OutputDir);
+		return 1;
+	}
+
+	UE_LOG(LogEasyEIBindingsBenchmark, Display, TEXT("Wrote %s and %s."), *CsvPath, *JsonPath);
+	return 0;
+}
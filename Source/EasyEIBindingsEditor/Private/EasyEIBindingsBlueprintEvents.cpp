@@ -0,0 +1,206 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+
+#include "EasyEIBindingsBlueprintEvents.h"
+
+#include "EasyEIBindingsComponent.h"
+#include "EdGraph/EdGraph.h"
+#include "Engine/Blueprint.h"
+#include "Engine/BlueprintGeneratedClass.h"
+#include "Engine/SCS_Node.h"
+#include "Engine/SimpleConstructionScript.h"
+#include "GameFramework/Actor.h"
+#include "InputAction.h"
+#include "K2Node_EnhancedInputAction.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Misc/ScopedSlowTask.h"
+#include "ScopedTransaction.h"
+
+#define LOCTEXT_NAMESPACE "EasyEIBlueprintEventGenerator"
+
+TSet<const UInputAction*> FEasyEIBlueprintEventGenerator::IndexExistingEvents(const UBlueprint* Blueprint)
+{
+	TSet<const UInputAction*> ExistingActions;
+	if (!Blueprint)
+	{
+		return ExistingActions;
+	}
+
+	for (const UEdGraph* Graph : Blueprint->UbergraphPages)
+	{
+		if (!Graph)
+		{
+			continue;
+		}
+
+		for (const UEdGraphNode* Node : Graph->Nodes)
+		{
+			if (const UK2Node_EnhancedInputAction* InputActionNode = Cast<UK2Node_EnhancedInputAction>(Node))
+			{
+				ExistingActions.Add(InputActionNode->InputAction);
+			}
+		}
+	}
+	return ExistingActions;
+}
+
+FEasyEIBlueprintEventsResult FEasyEIBlueprintEventGenerator::Generate(UBlueprint* Blueprint, TConstArrayView<FEasyEIBinding> Bindings)
+{
+	FEasyEIBlueprintEventsResult Result;
+	if (!Blueprint)
+	{
+		return Result;
+	}
+
+	UEdGraph* EventGraph = FBlueprintEditorUtils::FindEventGraph(Blueprint);
+	if (!EventGraph)
+	{
+		Result.FailedBlueprints = 1;
+		return Result;
+	}
+
+	// Bindings that share an action get one node, so the index also tracks nodes added below
+	TSet<const UInputAction*> HandledActions = IndexExistingEvents(Blueprint);
+	TArray<UInputAction*> MissingActions;
+
+	for (const FEasyEIBinding& Binding : Bindings)
+	{
+		if (Binding.EnabledEvents == 0)
+		{
+			continue;
+		}
+
+		UInputAction* InputAction = Binding.InputAction ? Binding.InputAction.Get() : Binding.SoftInputAction.LoadSynchronous();
+		if (!InputAction)
+		{
+			continue;
+		}
+
+		bool bAlreadyHandled = false;
+		HandledActions.Add(InputAction, &bAlreadyHandled);
+		if (bAlreadyHandled)
+		{
+			Result.SkippedCount++;
+			continue;
+		}
+
+		MissingActions.Add(InputAction);
+	}
+
+	if (MissingActions.Num() == 0)
+	{
+		return Result;
+	}
+
+	float NodePosY = 0.f;
+	for (const UEdGraphNode* Node : EventGraph->Nodes)
+	{
+		if (Node)
+		{
+			NodePosY = FMath::Max(NodePosY, Node->NodePosY + 200.f);
+		}
+	}
+
+	Blueprint->Modify();
+	EventGraph->Modify();
+
+	for (UInputAction* InputAction : MissingActions)
+	{
+		UK2Node_EnhancedInputAction* NewInputActionNode = NewObject<UK2Node_EnhancedInputAction>(EventGraph);
+		NewInputActionNode->InputAction = InputAction;
+		NewInputActionNode->CreateNewGuid();
+		NewInputActionNode->PostPlacedNewNode();
+		NewInputActionNode->SetFlags(RF_Transactional);
+		NewInputActionNode->AllocateDefaultPins();
+
+		NewInputActionNode->NodePosX = 0;
+		NewInputActionNode->NodePosY = NodePosY;
+		NodePosY += 300.f;
+
+		EventGraph->AddNode(NewInputActionNode, false, false);
+	}
+
+	// One structural modification for the whole batch instead of one per node
+	FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
+
+	Result.GeneratedCount = MissingActions.Num();
+	Result.ModifiedBlueprints = 1;
+	return Result;
+}
+
+FEasyEIBlueprintEventsResult FEasyEIBlueprintEventGenerator::Generate(UBlueprint* Blueprint)
+{
+	TArray<FEasyEIBinding> Bindings;
+	CollectBindings(Blueprint, Bindings);
+	return Generate(Blueprint, Bindings);
+}
+
+void FEasyEIBlueprintEventGenerator::CollectBindings(const UBlueprint* Blueprint, TArray<FEasyEIBinding>& OutBindings)
+{
+	TArray<const UEasyEIBindingsComponent*> Components;
+	CollectComponents(Blueprint, Components);
+	for (const UEasyEIBindingsComponent* Component : Components)
+	{
+		OutBindings.Append(Component->InputBindings);
+	}
+}
+
+void FEasyEIBlueprintEventGenerator::CollectComponents(const UBlueprint* Blueprint, TArray<const UEasyEIBindingsComponent*>& OutComponents)
+{
+	if (!Blueprint || !Blueprint->GeneratedClass)
+	{
+		return;
+	}
+
+	// Components added in this or a parent Blueprint live as construction script templates. A child Blueprint that
+	// edits an inherited component stores its own template, which GetActualComponentTemplate prefers.
+	UBlueprintGeneratedClass* ActualClass = Cast<UBlueprintGeneratedClass>(Blueprint->GeneratedClass);
+	TArray<const UBlueprintGeneratedClass*> ClassHierarchy;
+	UBlueprintGeneratedClass::GetGeneratedClassesHierarchy(Blueprint->GeneratedClass, ClassHierarchy);
+	for (const UBlueprintGeneratedClass* Class : ClassHierarchy)
+	{
+		const USimpleConstructionScript* ConstructionScript = Class->SimpleConstructionScript;
+		if (!ConstructionScript)
+		{
+			continue;
+		}
+
+		for (const USCS_Node* Node : ConstructionScript->GetAllNodes())
+		{
+			if (const UEasyEIBindingsComponent* Component = Node ? Cast<UEasyEIBindingsComponent>(Node->GetActualComponentTemplate(ActualClass)) : nullptr)
+			{
+				OutComponents.Add(Component);
+			}
+		}
+	}
+
+	// Components created by a native parent live on the class default object
+	if (const AActor* DefaultActor = Cast<AActor>(Blueprint->GeneratedClass->GetDefaultObject()))
+	{
+		TInlineComponentArray<UEasyEIBindingsComponent*> Components(DefaultActor);
+		OutComponents.Append(Components);
+	}
+}
+
+FEasyEIBlueprintEventsResult FEasyEIBlueprintEventGenerator::GenerateBatch(TConstArrayView<UBlueprint*> Blueprints)
+{
+	FEasyEIBlueprintEventsResult Total;
+
+	FScopedSlowTask SlowTask(Blueprints.Num(), LOCTEXT("GeneratingEvents", "Generating Input Action events..."));
+	SlowTask.MakeDialogDelayed(0.5f);
+
+	const FScopedTransaction Transaction(LOCTEXT("GenerateBlueprintInputEventsBatch", "Generate Blueprint Input Events"));
+	for (UBlueprint* Blueprint : Blueprints)
+	{
+		SlowTask.EnterProgressFrame();
+
+		const FEasyEIBlueprintEventsResult Result = Generate(Blueprint);
+		Total.GeneratedCount += Result.GeneratedCount;
+		Total.SkippedCount += Result.SkippedCount;
+		Total.ModifiedBlueprints += Result.ModifiedBlueprints;
+		Total.FailedBlueprints += Result.FailedBlueprints;
+	}
+	return Total;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -3,26 +3,91 @@
 
 #include "EasyEIBindingsComponentDetails.h"
 
+#include "AssetRegistry/AssetRegistryModule.h"
 #include "AssetToolsModule.h"
 #include "ContentBrowserModule.h"
 #include "DetailCategoryBuilder.h"
 #include "DetailLayoutBuilder.h"
 #include "DetailWidgetRow.h"
+#include "EasyEIBindings.h"
+#include "EasyEIBindingsBlueprintEvents.h"
+#include "EasyEIBindingsCppStubs.h"
 #include "EasyEIBindingsComponent.h"
 #include "EasyEIBindingsDeveloperSettings.h"
 #include "IContentBrowserSingleton.h"
+#include "IDetailChildrenBuilder.h"
+#include "IDetailPropertyRow.h"
 #include "InputAction.h"
+#include "PropertyCustomizationHelpers.h"
+#include "ScopedTransaction.h"
 #include "SourceCodeNavigation.h"
+#include "Styling/CoreStyle.h"
 #include "Widgets/Images/SImage.h"
+#include "Widgets/Layout/SBox.h"
 #include "Widgets/Text/STextBlock.h"
 #include "Kismet2/BlueprintEditorUtils.h"
 #include "EdGraphSchema_K2.h"
-
-// Enhanced Input Blueprint nodes
-#include "K2Node_EnhancedInputAction.h"
+#include "UObject/ObjectKey.h"
 
 #define LOCTEXT_NAMESPACE "EasyEIBindingsComponentDetails"
 
+namespace EasyEIBindingStatus
+{
+	/** Handler names of one action and the event slots the owner class implements. */
+	struct FActionHandlers
+	{
+		FString HandlerNames[EasyEIBindings::NumTriggerEvents];
+		uint8 ImplementedEventSlots = 0;
+	};
+
+	/**
+	 * Resolved handlers per (owner class, action path), shared by every details panel so a rebuilt panel reuses
+	 * what the previous one resolved. Dropped whenever the binding cache generation changes, i.e. on a compile or reload.
+	 */
+	struct FCache
+	{
+		uint32 Generation = 0;
+		TMap<TPair<TObjectKey<UClass>, FSoftObjectPath>, FActionHandlers> Entries;
+	};
+
+	static FCache& GetCache()
+	{
+		static FCache Cache;
+		return Cache;
+	}
+
+	/** Cached handlers, null when not resolved yet. */
+	static const FActionHandlers* Find(const UClass* OwnerClass, const FSoftObjectPath& ActionPath)
+	{
+		FCache& Cache = GetCache();
+		const uint32 Generation = FEasyEIBindingsModule::Get().GetBindingCache().GetGeneration();
+		if (Cache.Generation != Generation)
+		{
+			Cache.Entries.Reset();
+			Cache.Generation = Generation;
+			return nullptr;
+		}
+		return Cache.Entries.Find(MakeTuple(TObjectKey<UClass>(OwnerClass), ActionPath));
+	}
+
+	/** Handler names come from the action path so soft actions are never loaded here. */
+	static const FActionHandlers& Resolve(const UClass* OwnerClass, const FSoftObjectPath& ActionPath)
+	{
+		FActionHandlers& Handlers = GetCache().Entries.Add(MakeTuple(TObjectKey<UClass>(OwnerClass), ActionPath));
+		const FString ActionName = ActionPath.GetAssetName();
+		for (int32 EventIndex = 0; EventIndex < EasyEIBindings::NumTriggerEvents; ++EventIndex)
+		{
+			const FName HandlerName = EasyEIBindings::MakeHandlerName(ActionName, EventIndex);
+			Handlers.HandlerNames[EventIndex] = HandlerName.ToString();
+			if (OwnerClass->FindFunctionByName(HandlerName))
+			{
+				Handlers.ImplementedEventSlots |= 1 << EventIndex;
+			}
+		}
+		return Handlers;
+	}
+}
+
 static bool PromptForInputActionSavePath(FString& OutPackagePath, FString& OutAssetName)
 {
 	const UEasyEIBindingsDeveloperSettings* Settings = UEasyEIBindingsDeveloperSettings::Get();
@@ -48,13 +113,44 @@ static bool PromptForInputActionSavePath(FString& OutPackagePath, FString& OutAs
 	return true;
 }
 
-struct FBindingStatus
+static FString GetDefaultInputActionFolder()
+{
+	const UEasyEIBindingsDeveloperSettings* Settings = UEasyEIBindingsDeveloperSettings::Get();
+	return Settings && !Settings->DefaultInputActionPath.Path.IsEmpty() ? Settings->DefaultInputActionPath.Path : TEXT("/Game/Input");
+}
+
+static bool HasInputActionPrefix(FName AssetName)
+{
+	const UEasyEIBindingsDeveloperSettings* Settings = UEasyEIBindingsDeveloperSettings::Get();
+	return !Settings || Settings->InputActionPrefix.IsEmpty() || AssetName.ToString().StartsWith(Settings->InputActionPrefix);
+}
+
+static FSoftObjectPath GetBindingActionPath(const FEasyEIBinding& Binding)
+{
+	return Binding.InputAction ? FSoftObjectPath(Binding.InputAction) : Binding.SoftInputAction.ToSoftObjectPath();
+}
+
+// Registry query only, nothing is loaded
+static void GatherFolderInputActions(const FString& Folder, TArray<FAssetData>& OutAssets)
+{
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.ScanPathsSynchronous({Folder});
+
+	FARFilter Filter;
+	Filter.PackagePaths.Add(*Folder);
+	Filter.ClassPaths.Add(UInputAction::StaticClass()->GetClassPathName());
+	Filter.bRecursivePaths = true;
+	Filter.bRecursiveClasses = true;
+	AssetRegistry.GetAssets(Filter, OutAssets);
+
+	OutAssets.RemoveAllSwap([](const FAssetData& Asset) { return !HasInputActionPrefix(Asset.AssetName); });
+	OutAssets.Sort([](const FAssetData& A, const FAssetData& B) { return A.AssetName.LexicalLess(B.AssetName); });
+}
+
+FEasyEIBindingsComponentDetails::~FEasyEIBindingsComponentDetails()
 {
-	FString FunctionName;
-	ETriggerEvent Event;
-	bool bExists;
-	bool bIsEnabled;
-};
+	FTSTicker::GetCoreTicker().RemoveTicker(StatusRefreshHandle);
+}
 
 void FEasyEIBindingsComponentDetails::CustomizeDetails(IDetailLayoutBuilder& DetailBuilder)
 {
@@ -85,14 +181,58 @@ void FEasyEIBindingsComponentDetails::CustomizeDetails(IDetailLayoutBuilder& Det
 
 	const TSharedRef<IPropertyHandle> InputBindingsArray = DetailBuilder.GetProperty(
 		GET_MEMBER_NAME_CHECKED(UEasyEIBindingsComponent, InputBindings));
+	InputBindingsHandle = InputBindingsArray;
 
 	IDetailCategoryBuilder& Cat = DetailBuilder.EditCategory("Easy EI Bindings");
-	Cat.AddProperty(InputBindingsArray);
 
 	const UEasyEIBindingsDeveloperSettings* Settings = UEasyEIBindingsDeveloperSettings::Get();
-	if (Settings && Settings->bShowBindingStatus && OwnerComponent.IsValid() && CachedOwnerClass)
+	const bool bShowStatus = Settings && Settings->bShowBindingStatus && OwnerComponent.IsValid() && CachedOwnerClass;
+	const bool bUseTable = Settings && OwnerComponent.IsValid() && Settings->BindingTableThreshold > 0
+		&& OwnerComponent->InputBindings.Num() >= Settings->BindingTableThreshold;
+
+	if (bShowStatus || bUseTable)
+	{
+		// Rows read the cached status through attributes, so edits only schedule a recomputation
+		const FSimpleDelegate OnBindingsChanged = FSimpleDelegate::CreateSP(
+			this, &FEasyEIBindingsComponentDetails::OnInputBindingsChanged);
+		InputBindingsArray->SetOnPropertyValueChanged(OnBindingsChanged);
+		InputBindingsArray->SetOnChildPropertyValueChanged(OnBindingsChanged);
+	}
+
+	BindingTable.Reset();
+	if (bUseTable)
+	{
+		// Large components get the virtualized table, the full property rows stay available under advanced
+		FOnGetEasyEIBindingRowStatus OnGetRowStatus;
+		if (bShowStatus)
+		{
+			OnGetRowStatus.BindSP(this, &FEasyEIBindingsComponentDetails::FindRowStatus);
+		}
+
+		Cat.AddCustomRow(FText::FromString("InputBindings"))
+		   .WholeRowWidget
+		[
+			SAssignNew(BindingTable, SEasyEIBindingTable, OwnerComponent.Get(), InputBindingsArray)
+			.OnGetRowStatus(OnGetRowStatus)
+		];
+		Cat.AddProperty(InputBindingsArray, EPropertyLocation::Advanced);
+	}
+	else if (bShowStatus)
+	{
+		const TSharedRef<FDetailArrayBuilder> BindingsBuilder = MakeShareable(new FDetailArrayBuilder(InputBindingsArray));
+		BindingsBuilder->OnGenerateArrayElementWidget(
+			FOnGenerateArrayElementWidget::CreateSP(this, &FEasyEIBindingsComponentDetails::GenerateBindingRow));
+		Cat.AddCustomBuilder(BindingsBuilder);
+	}
+	else
+	{
+		Cat.AddProperty(InputBindingsArray);
+	}
+
+	if (bShowStatus)
 	{
 		AddBindingStatusWidget(Cat);
+		RequestStatusRefresh();
 	}
 
 	Cat.AddCustomRow(FText::FromString("EasyEIButtons"))
@@ -145,109 +285,259 @@ void FEasyEIBindingsComponentDetails::CustomizeDetails(IDetailLayoutBuilder& Det
 				.OnClicked(FOnClicked::CreateSP(this, &FEasyEIBindingsComponentDetails::OnAddFromFolder))
 			]
 		]
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(0, 4, 0, 0)
+		[
+			SNew(SButton)
+			.Text(FText::FromString("Sync with Input Action Folder"))
+			.ToolTipText(FText::FromString(
+				"Adds every Input Action in the default Input Action folder that matches the naming prefix, "
+				"and removes bindings to actions that are no longer in that folder."))
+			.OnClicked(FOnClicked::CreateSP(this, &FEasyEIBindingsComponentDetails::OnSyncWithFolder))
+		]
 	];
 }
 
 void FEasyEIBindingsComponentDetails::AddBindingStatusWidget(IDetailCategoryBuilder& Category)
+{
+	Category.AddCustomRow(FText::FromString("BindingStatus"))
+	        .WholeRowWidget
+	[
+		SNew(SHorizontalBox)
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.Padding(4, 2)
+		[
+			SNew(STextBlock)
+			.Text(TAttribute<FText>::CreateSP(this, &FEasyEIBindingsComponentDetails::GetStatusText))
+			.ColorAndOpacity(TAttribute<FSlateColor>::CreateSP(this, &FEasyEIBindingsComponentDetails::GetStatusColor))
+		]
+	];
+}
+
+void FEasyEIBindingsComponentDetails::GenerateBindingRow(TSharedRef<IPropertyHandle> ElementHandle, int32 ArrayIndex,
+                                                         IDetailChildrenBuilder& ChildrenBuilder)
+{
+	IDetailPropertyRow& Row = ChildrenBuilder.AddProperty(ElementHandle);
+
+	TSharedPtr<SWidget> NameWidget;
+	TSharedPtr<SWidget> ValueWidget;
+	Row.GetDefaultWidgets(NameWidget, ValueWidget);
+
+	Row.CustomWidget(true)
+	   .NameContent()
+	[
+		SNew(SHorizontalBox)
+		+ SHorizontalBox::Slot()
+		.AutoWidth()
+		.VAlign(VAlign_Center)
+		.Padding(0, 0, 4, 0)
+		[
+			SNew(SBox)
+			.WidthOverride(8)
+			.HeightOverride(8)
+			[
+				SNew(SImage)
+				.Image(FCoreStyle::Get().GetBrush("GenericWhiteBox"))
+				.ColorAndOpacity(TAttribute<FSlateColor>::CreateSP(this, &FEasyEIBindingsComponentDetails::GetRowStatusColor, ArrayIndex))
+				.ToolTipText(TAttribute<FText>::CreateSP(this, &FEasyEIBindingsComponentDetails::GetRowStatusToolTip, ArrayIndex))
+			]
+		]
+		+ SHorizontalBox::Slot()
+		.FillWidth(1)
+		.VAlign(VAlign_Center)
+		[
+			NameWidget.ToSharedRef()
+		]
+	]
+	.ValueContent()
+	[
+		ValueWidget.ToSharedRef()
+	];
+}
+
+void FEasyEIBindingsComponentDetails::OnInputBindingsChanged()
+{
+	if (BindingTable.IsValid())
+	{
+		BindingTable->RefreshItems();
+	}
+
+	const UEasyEIBindingsDeveloperSettings* Settings = UEasyEIBindingsDeveloperSettings::Get();
+	if (Settings && Settings->bShowBindingStatus && CachedOwnerClass)
+	{
+		RequestStatusRefresh();
+	}
+}
+
+void FEasyEIBindingsComponentDetails::RequestStatusRefresh()
+{
+	if (StatusRefreshHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(StatusRefreshHandle);
+		StatusRefreshHandle.Reset();
+	}
+
+	bStatusValid = false;
+	NextStatusRow = 0;
+	RowStatuses.Reset();
+
+	// Rows with cached handlers are filled in right away, the ticker only picks up the ones still to resolve
+	if (TickStatusRefresh(0.f))
+	{
+		StatusRefreshHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateSP(this, &FEasyEIBindingsComponentDetails::TickStatusRefresh));
+	}
+}
+
+bool FEasyEIBindingsComponentDetails::TickStatusRefresh(float DeltaTime)
 {
 	if (!OwnerComponent.IsValid() || !CachedOwnerClass)
 	{
-		return;
+		NextStatusRow = INDEX_NONE;
+		StatusRefreshHandle.Reset();
+		return false;
 	}
 
-	TArray<FBindingStatus> AllStatuses;
-	GatherBindingStatuses(AllStatuses);
+	// Keeps large binding lists from stalling the editor in a single frame
+	constexpr double TimeBudgetSeconds = 0.002;
+	const double StartTime = FPlatformTime::Seconds();
 
-	if (AllStatuses.Num() == 0)
+	const TArray<FEasyEIBinding>& Bindings = OwnerComponent->InputBindings;
+
+	// The cache generation bumps on recompiles, which is when the owner's handlers can change
+	if (NextStatusRow == 0)
 	{
-		return;
+		StatusGeneration = FEasyEIBindingsModule::Get().GetBindingCache().GetGeneration();
 	}
 
-	int32 BoundCount = 0;
-	int32 MissingCount = 0;
-	for (const FBindingStatus& Status : AllStatuses)
+	while (NextStatusRow < Bindings.Num())
 	{
-		if (Status.bIsEnabled)
+		const FEasyEIBinding& Binding = Bindings[NextStatusRow];
+		const FSoftObjectPath ActionPath = GetBindingActionPath(Binding);
+
+		// Only uncached actions count against the budget, cached rows are a lookup
+		const EasyEIBindingStatus::FActionHandlers* Handlers = nullptr;
+		if (!ActionPath.IsNull())
 		{
-			if (Status.bExists)
+			Handlers = EasyEIBindingStatus::Find(CachedOwnerClass, ActionPath);
+			if (!Handlers)
 			{
-				BoundCount++;
+				if (FPlatformTime::Seconds() - StartTime > TimeBudgetSeconds)
+				{
+					return true;
+				}
+				Handlers = &EasyEIBindingStatus::Resolve(CachedOwnerClass, ActionPath);
 			}
-			else
+		}
+
+		FEasyEIBindingRowStatus& Status = RowStatuses.AddDefaulted_GetRef();
+		Status.EnabledEventSlots = Binding.GetEnabledEventSlots();
+		if (Handlers)
+		{
+			Status.bHasAction = true;
+			Status.BoundEventSlots = Status.EnabledEventSlots & Handlers->ImplementedEventSlots;
+
+			FString ToolTip;
+			for (int32 EventIndex = 0; EventIndex < EasyEIBindings::NumTriggerEvents; ++EventIndex)
 			{
-				MissingCount++;
+				const bool bEnabled = (Status.EnabledEventSlots & (1 << EventIndex)) != 0;
+				const bool bBound = (Handlers->ImplementedEventSlots & (1 << EventIndex)) != 0;
+				if (!ToolTip.IsEmpty())
+				{
+					ToolTip += TEXT('\n');
+				}
+				ToolTip += Handlers->HandlerNames[EventIndex];
+				ToolTip += !bEnabled ? TEXT(": disabled") : bBound ? TEXT(": bound") : TEXT(": missing");
 			}
+			Status.ToolTip = FText::FromString(MoveTemp(ToolTip));
 		}
+		else
+		{
+			Status.ToolTip = LOCTEXT("NoInputAction", "No Input Action assigned.");
+		}
+
+		++NextStatusRow;
 	}
 
-	FString StatusText = FString::Printf(TEXT("Binding Status: %d bound, %d missing"), BoundCount, MissingCount);
-	FSlateColor StatusColor = MissingCount > 0 ? FSlateColor(FLinearColor::Yellow) : FSlateColor(FLinearColor::Green);
+	bStatusValid = true;
+	NextStatusRow = INDEX_NONE;
+	StatusRefreshHandle.Reset();
+	return false;
+}
 
-	Category.AddCustomRow(FText::FromString("BindingStatus"))
-	        .WholeRowWidget
-	[
-		SNew(SHorizontalBox)
-		+ SHorizontalBox::Slot()
-		.AutoWidth()
-		.Padding(4, 2)
-		[
-			SNew(STextBlock)
-			.Text(FText::FromString(StatusText))
-			.ColorAndOpacity(StatusColor)
-		]
-	];
+bool FEasyEIBindingsComponentDetails::IsStatusStale() const
+{
+	if (!OwnerComponent.IsValid())
+	{
+		return false;
+	}
+
+	return RowStatuses.Num() != OwnerComponent->InputBindings.Num()
+		|| StatusGeneration != FEasyEIBindingsModule::Get().GetBindingCache().GetGeneration();
 }
 
-void FEasyEIBindingsComponentDetails::GatherBindingStatuses(TArray<FBindingStatus>& OutStatuses)
+FText FEasyEIBindingsComponentDetails::GetStatusText()
 {
-	if (!OwnerComponent.IsValid() || !CachedOwnerClass)
+	if (bStatusValid && IsStatusStale())
 	{
-		return;
+		RequestStatusRefresh();
 	}
 
-	const TPair<const TCHAR*, ETriggerEvent> Specs[] = {
-		{TEXT("Triggered"), ETriggerEvent::Triggered},
-		{TEXT("Started"), ETriggerEvent::Started},
-		{TEXT("Ongoing"), ETriggerEvent::Ongoing},
-		{TEXT("Completed"), ETriggerEvent::Completed},
-		{TEXT("Canceled"), ETriggerEvent::Canceled}
-	};
+	if (!bStatusValid)
+	{
+		return LOCTEXT("BindingStatusPending", "Binding Status: checking...");
+	}
 
-	for (const FEasyEIBinding& Binding : OwnerComponent->InputBindings)
+	int32 BoundCount = 0;
+	int32 MissingCount = 0;
+	for (const FEasyEIBindingRowStatus& Status : RowStatuses)
 	{
-		if (!Binding.InputAction)
-		{
-			continue;
-		}
+		BoundCount += FMath::CountBits(Status.BoundEventSlots);
+		MissingCount += Status.GetNumMissing();
+	}
 
-		FString ActionName = Binding.InputAction->GetName();
-		ActionName.RemoveFromStart(TEXT("IA_"));
+	return FText::FromString(FString::Printf(TEXT("Binding Status: %d bound, %d missing"), BoundCount, MissingCount));
+}
+
+FSlateColor FEasyEIBindingsComponentDetails::GetStatusColor()
+{
+	if (!bStatusValid)
+	{
+		return FSlateColor::UseSubduedForeground();
+	}
 
-		for (const auto& Spec : Specs)
+	for (const FEasyEIBindingRowStatus& Status : RowStatuses)
+	{
+		if (Status.GetNumMissing() > 0)
 		{
-			FBindingStatus Status;
-			Status.FunctionName = FString::Printf(TEXT("IA_%s_%s"), *ActionName, Spec.Key);
-			Status.Event = Spec.Value;
-			Status.bIsEnabled = Binding.IsEventEnabled(Spec.Value);
-			Status.bExists = CachedOwnerClass->FindFunctionByName(FName(*Status.FunctionName)) != nullptr;
-			OutStatuses.Add(Status);
+			return FSlateColor(FLinearColor::Yellow);
 		}
 	}
+	return FSlateColor(FLinearColor::Green);
 }
 
-bool FEasyEIBindingsComponentDetails::DoesFunctionExist(UClass* OwnerClass, const FString& FunctionName)
+const FEasyEIBindingRowStatus* FEasyEIBindingsComponentDetails::FindRowStatus(int32 ArrayIndex)
 {
-	if (!OwnerClass)
+	if (bStatusValid && IsStatusStale())
 	{
-		return false;
+		RequestStatusRefresh();
 	}
 
-	if (OwnerClass->FindFunctionByName(FName(*FunctionName)))
-	{
-		return true;
-	}
+	return bStatusValid && RowStatuses.IsValidIndex(ArrayIndex) ? &RowStatuses[ArrayIndex] : nullptr;
+}
 
-	return false;
+FSlateColor FEasyEIBindingsComponentDetails::GetRowStatusColor(int32 ArrayIndex)
+{
+	const FEasyEIBindingRowStatus* Status = FindRowStatus(ArrayIndex);
+	return FSlateColor(Status ? Status->GetIndicatorColor() : FLinearColor::Transparent);
+}
+
+FText FEasyEIBindingsComponentDetails::GetRowStatusToolTip(int32 ArrayIndex)
+{
+	const FEasyEIBindingRowStatus* Status = FindRowStatus(ArrayIndex);
+	return Status ? Status->ToolTip : LOCTEXT("RowStatusPending", "Checking handlers...");
 }
 
 FReply FEasyEIBindingsComponentDetails::OnCreateInputAction()
@@ -287,45 +577,114 @@ FReply FEasyEIBindingsComponentDetails::OnAddFromFolder()
 
 	FOpenAssetDialogConfig Config;
 	Config.DialogTitleOverride = FText::FromString("Select Input Actions");
-	Config.DefaultPath = TEXT("/Game/Input");
+	Config.DefaultPath = GetDefaultInputActionFolder();
 	Config.bAllowMultipleSelection = true;
 	Config.AssetClassNames.Add(UInputAction::StaticClass()->GetClassPathName());
 
-	TArray<FAssetData> SelectedAssets = ContentBrowserModule.Get().CreateModalOpenAssetDialog(Config);
+	const TArray<FAssetData> SelectedAssets = ContentBrowserModule.Get().CreateModalOpenAssetDialog(Config);
+	if (SelectedAssets.Num() > 0)
+	{
+		ApplyFolderBindings(SelectedAssets, FString(), LOCTEXT("AddInputActionsFromFolder", "Add Input Actions from Folder"));
+	}
+
+	return FReply::Handled();
+}
 
-	if (SelectedAssets.Num() > 0 && OwnerComponent.IsValid())
+FReply FEasyEIBindingsComponentDetails::OnSyncWithFolder()
+{
+	const FString Folder = GetDefaultInputActionFolder();
+
+	TArray<FAssetData> FolderAssets;
+	GatherFolderInputActions(Folder, FolderAssets);
+	ApplyFolderBindings(FolderAssets, Folder, LOCTEXT("SyncInputActionsWithFolder", "Sync Input Actions with Folder"));
+
+	return FReply::Handled();
+}
+
+void FEasyEIBindingsComponentDetails::ApplyFolderBindings(const TArray<FAssetData>& Assets, const FString& SyncFolder,
+                                                           const FText& TransactionText)
+{
+	if (!OwnerComponent.IsValid())
+	{
+		return;
+	}
+
+	TArray<FEasyEIBinding>& Bindings = OwnerComponent->InputBindings;
+
+	TSet<FSoftObjectPath> AssetPaths;
+	AssetPaths.Reserve(Assets.Num());
+	for (const FAssetData& Asset : Assets)
 	{
-		const UEasyEIBindingsDeveloperSettings* Settings = UEasyEIBindingsDeveloperSettings::Get();
-		FScopedTransaction Tx(LOCTEXT("AddInputActionsFromFolder", "Add Input Actions from Folder"));
-		OwnerComponent->Modify();
+		AssetPaths.Add(Asset.GetSoftObjectPath());
+	}
 
-		for (const FAssetData& AssetData : SelectedAssets)
+	// Bindings under the synced folder whose action is gone or no longer matches the prefix
+	TSet<FSoftObjectPath> Removals;
+	TSet<FSoftObjectPath> ExistingPaths;
+	ExistingPaths.Reserve(Bindings.Num());
+	for (const FEasyEIBinding& Binding : Bindings)
+	{
+		const FSoftObjectPath ActionPath = GetBindingActionPath(Binding);
+		if (ActionPath.IsNull())
 		{
-			UInputAction* IA = Cast<UInputAction>(AssetData.GetAsset());
-			if (IA)
-			{
-				bool bAlreadyExists = false;
-				for (const FEasyEIBinding& Existing : OwnerComponent->InputBindings)
-				{
-					if (Existing.InputAction == IA)
-					{
-						bAlreadyExists = true;
-						break;
-					}
-				}
+			continue;
+		}
 
-				if (!bAlreadyExists)
-				{
-					FEasyEIBinding NewBinding;
-					NewBinding.InputAction = IA;
-					NewBinding.EnabledEvents = Settings ? Settings->DefaultEnabledEvents : 0x1F;
-					OwnerComponent->InputBindings.Add(NewBinding);
-				}
-			}
+		ExistingPaths.Add(ActionPath);
+		if (!SyncFolder.IsEmpty() && !AssetPaths.Contains(ActionPath)
+			&& FPaths::IsUnderDirectory(ActionPath.GetLongPackageName(), SyncFolder))
+		{
+			Removals.Add(ActionPath);
 		}
 	}
 
-	return FReply::Handled();
+	TArray<FSoftObjectPath> Additions;
+	for (const FAssetData& Asset : Assets)
+	{
+		FSoftObjectPath AssetPath = Asset.GetSoftObjectPath();
+		if (!ExistingPaths.Contains(AssetPath))
+		{
+			ExistingPaths.Add(AssetPath);
+			Additions.Add(MoveTemp(AssetPath));
+		}
+	}
+
+	if (Additions.IsEmpty() && Removals.IsEmpty())
+	{
+		return;
+	}
+
+	const UEasyEIBindingsDeveloperSettings* Settings = UEasyEIBindingsDeveloperSettings::Get();
+	const int32 EnabledEvents = Settings ? Settings->DefaultEnabledEvents : 0x1F;
+
+	const FScopedTransaction Transaction(TransactionText);
+	if (InputBindingsHandle.IsValid())
+	{
+		InputBindingsHandle->NotifyPreChange();
+	}
+	OwnerComponent->Modify();
+
+	if (!Removals.IsEmpty())
+	{
+		Bindings.RemoveAll([&Removals](const FEasyEIBinding& Binding)
+		{
+			return Removals.Contains(GetBindingActionPath(Binding));
+		});
+	}
+
+	// Added as soft references so the actions stay unloaded until the component sets up
+	Bindings.Reserve(Bindings.Num() + Additions.Num());
+	for (const FSoftObjectPath& ActionPath : Additions)
+	{
+		FEasyEIBinding& NewBinding = Bindings.AddDefaulted_GetRef();
+		NewBinding.SoftInputAction = TSoftObjectPtr<UInputAction>(ActionPath);
+		NewBinding.EnabledEvents = EnabledEvents;
+	}
+
+	if (InputBindingsHandle.IsValid())
+	{
+		InputBindingsHandle->NotifyPostChange(EPropertyChangeType::ValueSet);
+	}
 }
 
 FReply FEasyEIBindingsComponentDetails::GenerateStubs()
@@ -421,105 +780,30 @@ void FEasyEIBindingsComponentDetails::GenerateBlueprintEvents(UBlueprint* Bluepr
 		return;
 	}
 
-	UEdGraph* EventGraph = FBlueprintEditorUtils::FindEventGraph(Blueprint);
-	if (!EventGraph)
+	const FEasyEIBlueprintEventsResult Result = FEasyEIBlueprintEventGenerator::Generate(Blueprint, OwnerComponent->InputBindings);
+
+	if (Result.FailedBlueprints > 0)
 	{
 		FMessageDialog::Open(
 			EAppMsgType::Ok,
 			FText::FromString(TEXT("Could not find the Event Graph in the Blueprint.")));
-		return;
-	}
-
-	const TPair<const TCHAR*, ETriggerEvent> Specs[] = {
-		{TEXT("Triggered"), ETriggerEvent::Triggered},
-		{TEXT("Started"), ETriggerEvent::Started},
-		{TEXT("Ongoing"), ETriggerEvent::Ongoing},
-		{TEXT("Completed"), ETriggerEvent::Completed},
-		{TEXT("Canceled"), ETriggerEvent::Canceled}
-	};
-
-	int32 GeneratedCount = 0;
-	int32 SkippedCount = 0;
-	float NodePosY = 0.f;
-
-	for (UEdGraphNode* Node : EventGraph->Nodes)
-	{
-		if (Node)
-		{
-			NodePosY = FMath::Max(NodePosY, Node->NodePosY + 200.f);
-		}
-	}
-
-	for (const FEasyEIBinding& Binding : OwnerComponent->InputBindings)
-	{
-		if (!Binding.InputAction)
-		{
-			continue;
-		}
-
-		for (const auto& Spec : Specs)
-		{
-			if (!Binding.IsEventEnabled(Spec.Value))
-			{
-				continue;
-			}
-
-			bool bEventExists = false;
-			for (UEdGraphNode* Node : EventGraph->Nodes)
-			{
-				if (UK2Node_EnhancedInputAction* InputActionNode = Cast<UK2Node_EnhancedInputAction>(Node))
-				{
-					if (InputActionNode->InputAction == Binding.InputAction)
-					{
-						bEventExists = true;
-						break;
-					}
-				}
-			}
-
-			if (bEventExists)
-			{
-				SkippedCount++;
-				continue;
-			}
-
-			UK2Node_EnhancedInputAction* NewInputActionNode = NewObject<UK2Node_EnhancedInputAction>(EventGraph);
-			NewInputActionNode->InputAction = Binding.InputAction;
-			NewInputActionNode->CreateNewGuid();
-			NewInputActionNode->PostPlacedNewNode();
-			NewInputActionNode->SetFlags(RF_Transactional);
-			NewInputActionNode->AllocateDefaultPins();
-
-			NewInputActionNode->NodePosX = 0;
-			NewInputActionNode->NodePosY = NodePosY;
-			NodePosY += 300.f;
-
-			EventGraph->AddNode(NewInputActionNode, false, false);
-
-			GeneratedCount++;
-
-			break;
-		}
 	}
-
-	if (GeneratedCount > 0)
+	else if (Result.GeneratedCount > 0)
 	{
-		FBlueprintEditorUtils::MarkBlueprintAsStructurallyModified(Blueprint);
-
 		FString Message = FString::Printf(
 			TEXT(
 				"Generated %d Enhanced Input Action node(s) in the Blueprint.\nSkipped %d existing node(s).\n\nThe nodes are ready to use in the Event Graph."),
-			GeneratedCount, SkippedCount);
+			Result.GeneratedCount, Result.SkippedCount);
 		FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(Message));
 	}
-	else if (SkippedCount > 0)
+	else if (Result.SkippedCount > 0)
 	{
 		FMessageDialog::Open(
 			EAppMsgType::Ok,
 			FText::FromString(
 				FString::Printf(
 					TEXT("All %d Input Action node(s) already exist in the Blueprint. Nothing to generate."),
-					SkippedCount)));
+					Result.SkippedCount)));
 	}
 	else
 	{
@@ -531,9 +815,11 @@ void FEasyEIBindingsComponentDetails::GenerateBlueprintEvents(UBlueprint* Bluepr
 
 void FEasyEIBindingsComponentDetails::GenerateCPPStubs(UClass* OwnerClass, bool bBlueprintImplementable)
 {
-	FString HeaderPath, SourcePath;
-	if (!FSourceCodeNavigation::FindClassHeaderPath(OwnerClass, HeaderPath) ||
-		!FSourceCodeNavigation::FindClassSourcePath(OwnerClass, SourcePath))
+	FEasyEICppStubGenerator Generator;
+	Generator.AddClass(OwnerClass, OwnerComponent->InputBindings, bBlueprintImplementable);
+	const FEasyEIStubPlan Plan = Generator.Plan();
+
+	if (Plan.Errors.Num() > 0)
 	{
 		FMessageDialog::Open(
 			EAppMsgType::Ok,
@@ -541,163 +827,22 @@ void FEasyEIBindingsComponentDetails::GenerateCPPStubs(UClass* OwnerClass, bool
 		return;
 	}
 
-	FString HeaderText;
-	FFileHelper::LoadFileToString(HeaderText, *HeaderPath);
-	FString SourceText;
-	FFileHelper::LoadFileToString(SourceText, *SourcePath);
-
-	const FString BeginMarker(TEXT("//Input actions"));
-	const FString EndMarker(TEXT("//Input actions END"));
-	int32 BeginIdx = HeaderText.Find(BeginMarker);
-	int32 EndIdx = HeaderText.Find(EndMarker);
-
-	if (BeginIdx == INDEX_NONE || EndIdx == INDEX_NONE)
-	{
-		int32 ProtectedIdx = HeaderText.Find(TEXT("protected:"), ESearchCase::IgnoreCase);
-		if (ProtectedIdx == INDEX_NONE)
-		{
-			int32 BraceIdx = HeaderText.Find(TEXT("{"));
-			if (BraceIdx == INDEX_NONE)
-			{
-				return;
-			}
-			ProtectedIdx = BraceIdx + 1;
-			HeaderText.InsertAt(ProtectedIdx, TEXT("\nprotected:\n"));
-			ProtectedIdx += FCString::Strlen(TEXT("\nprotected:\n"));
-		}
-		else
-		{
-			ProtectedIdx += FCString::Strlen(TEXT("protected:"));
-		}
-
-		const FString Block = FString::Printf(TEXT("\n\t%s\n\n\t%s\n"), *BeginMarker, *EndMarker);
-		HeaderText.InsertAt(ProtectedIdx, Block);
-		BeginIdx = HeaderText.Find(BeginMarker);
-		EndIdx = HeaderText.Find(EndMarker);
-	}
-
-	TSet<FString> ExistingInHeader;
-	{
-		FString Segment = HeaderText.Mid(BeginIdx, EndIdx - BeginIdx);
-		TArray<FString> Lines;
-		Segment.ParseIntoArrayLines(Lines, false);
-		for (const FString& L : Lines)
-		{
-			FString Trim = L.TrimStartAndEnd();
-			if (Trim.StartsWith(TEXT("UFUNCTION")))
-			{
-			}
-			if (Trim.StartsWith(TEXT("void IA_")))
-			{
-				int32 ParenIdx = Trim.Find(TEXT("("));
-				if (ParenIdx != INDEX_NONE)
-				{
-					FString FuncName = Trim.Mid(5, ParenIdx - 5);
-					ExistingInHeader.Add(FuncName);
-				}
-			}
-		}
-	}
-
-	const TPair<const TCHAR*, ETriggerEvent> Specs[] = {
-		{TEXT("Triggered"), ETriggerEvent::Triggered},
-		{TEXT("Started"), ETriggerEvent::Started},
-		{TEXT("Ongoing"), ETriggerEvent::Ongoing},
-		{TEXT("Completed"), ETriggerEvent::Completed},
-		{TEXT("Canceled"), ETriggerEvent::Canceled}
-	};
-
-	bool bDirty = false;
-	int32 GeneratedCount = 0;
-	int32 SkippedCount = 0;
-
-	for (const FEasyEIBinding& Binding : OwnerComponent->InputBindings)
-	{
-		if (!Binding.InputAction)
-		{
-			continue;
-		}
-
-		FString Clean = Binding.InputAction->GetName();
-		Clean.RemoveFromStart(TEXT("IA_"));
-
-		for (const auto& Spec : Specs)
-		{
-			if (!Binding.IsEventEnabled(Spec.Value))
-			{
-				continue;
-			}
-
-			FString FuncName = FString::Printf(TEXT("IA_%s_%s"), *Clean, Spec.Key);
-
-			if (DoesFunctionExist(OwnerClass, FuncName))
-			{
-				SkippedCount++;
-				continue;
-			}
-
-			if (ExistingInHeader.Contains(FuncName))
-			{
-				SkippedCount++;
-				continue;
-			}
-
-			FString Decl;
-			if (bBlueprintImplementable)
-			{
-				Decl = FString::Printf(
-					TEXT(
-						"\tUFUNCTION(BlueprintImplementableEvent, Category = \"Input\")\n\tvoid %s(const FInputActionValue& Value);\n\n"),
-					*FuncName);
-			}
-			else
-			{
-				Decl = FString::Printf(
-					TEXT("\tUFUNCTION()\n\tvoid %s(const FInputActionValue& Value);\n\n"), *FuncName);
-			}
-
-			HeaderText.InsertAt(EndIdx, Decl);
-			EndIdx += Decl.Len();
-			bDirty = true;
-			GeneratedCount++;
-
-			if (!bBlueprintImplementable)
-			{
-				FString ClassName = OwnerClass->GetName();
-				if (!ClassName.StartsWith(TEXT("A")) && !ClassName.StartsWith(TEXT("U")))
-				{
-					ClassName = TEXT("A") + ClassName;
-				}
-
-				FString Def = FString::Printf(
-					TEXT("\nvoid %s::%s(const FInputActionValue& Value)\n{\n}\n"), *ClassName, *FuncName);
-
-				FString FuncSignature = FString::Printf(TEXT("%s::%s"), *ClassName, *FuncName);
-				if (!SourceText.Contains(FuncSignature))
-				{
-					SourceText += Def;
-				}
-			}
-		}
-	}
-
-	if (bDirty)
+	if (Plan.HasChanges())
 	{
-		FFileHelper::SaveStringToFile(HeaderText, *HeaderPath);
-		FFileHelper::SaveStringToFile(SourceText, *SourcePath);
+		Plan.Write();
 
 		FString Message = FString::Printf(
 			TEXT(
 				"Generated %d function stub(s). Skipped %d existing function(s).\n\nPlease rebuild the project to use the new functions."),
-			GeneratedCount, SkippedCount);
+			Plan.GeneratedCount, Plan.SkippedCount);
 		FMessageDialog::Open(EAppMsgType::Ok, FText::FromString(Message));
 	}
-	else if (SkippedCount > 0)
+	else if (Plan.SkippedCount > 0)
 	{
 		FMessageDialog::Open(
 			EAppMsgType::Ok,
 			FText::FromString(
-				FString::Printf(TEXT("All %d function(s) already exist. Nothing to generate."), SkippedCount)));
+				FString::Printf(TEXT("All %d function(s) already exist. Nothing to generate."), Plan.SkippedCount)));
 	}
 	else
 	{
@@ -0,0 +1,364 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+
+#include "EasyEIBindingsCppStubs.h"
+
+#include "EasyEIBindingsCache.h"
+#include "EasyEIBindingsComponent.h"
+#include "InputAction.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "SourceCodeNavigation.h"
+
+namespace EasyEICppStubs
+{
+	static const TCHAR* BeginMarker = TEXT("//Input actions");
+	static const TCHAR* EndMarker = TEXT("//Input actions END");
+
+	static int32 FindInRange(const FString& Text, const TCHAR* Substring, int32 Start, int32 End,
+	                         ESearchCase::Type SearchCase = ESearchCase::CaseSensitive)
+	{
+		const int32 Index = Text.Find(Substring, SearchCase, ESearchDir::FromStart, Start);
+		return Index != INDEX_NONE && Index < End ? Index : INDEX_NONE;
+	}
+
+	static int32 GetLineStart(const FString& Text, int32 Index)
+	{
+		while (Index > 0 && Text[Index - 1] != TEXT('\n'))
+		{
+			--Index;
+		}
+		return Index;
+	}
+
+	static int32 GetNextLineStart(const FString& Text, int32 Index)
+	{
+		const int32 NewLine = Text.Find(TEXT("\n"), ESearchCase::CaseSensitive, ESearchDir::FromStart, Index);
+		return NewLine != INDEX_NONE ? NewLine + 1 : Text.Len();
+	}
+
+	/** Finds the braces of the class definition, skipping forward declarations and other identifiers containing the name. */
+	static bool FindClassBody(const FString& Text, const FString& ClassName, int32& OutBodyStart, int32& OutBodyEnd)
+	{
+		int32 SearchFrom = 0;
+		while (true)
+		{
+			const int32 NameIndex = Text.Find(ClassName, ESearchCase::CaseSensitive, ESearchDir::FromStart, SearchFrom);
+			if (NameIndex == INDEX_NONE)
+			{
+				return false;
+			}
+			SearchFrom = NameIndex + ClassName.Len();
+
+			const bool bWholeWord = (NameIndex == 0 || !FChar::IsIdentifier(Text[NameIndex - 1]))
+				&& (SearchFrom >= Text.Len() || !FChar::IsIdentifier(Text[SearchFrom]));
+			const int32 LineStart = GetLineStart(Text, NameIndex);
+			if (!bWholeWord || !Text.Mid(LineStart, NameIndex - LineStart).TrimStart().StartsWith(TEXT("class "), ESearchCase::CaseSensitive))
+			{
+				continue;
+			}
+
+			const int32 BraceIndex = Text.Find(TEXT("{"), ESearchCase::CaseSensitive, ESearchDir::FromStart, SearchFrom);
+			const int32 SemicolonIndex = Text.Find(TEXT(";"), ESearchCase::CaseSensitive, ESearchDir::FromStart, SearchFrom);
+			if (BraceIndex == INDEX_NONE || (SemicolonIndex != INDEX_NONE && SemicolonIndex < BraceIndex))
+			{
+				continue;
+			}
+
+			int32 Depth = 0;
+			for (int32 Index = BraceIndex; Index < Text.Len(); ++Index)
+			{
+				if (Text[Index] == TEXT('{'))
+				{
+					++Depth;
+				}
+				else if (Text[Index] == TEXT('}') && --Depth == 0)
+				{
+					OutBodyStart = BraceIndex;
+					OutBodyEnd = Index;
+					return true;
+				}
+			}
+			return false;
+		}
+	}
+
+	static TSet<FString> CollectDeclaredHandlers(const FString& Body)
+	{
+		TSet<FString> Declared;
+		TArray<FString> Lines;
+		Body.ParseIntoArrayLines(Lines, false);
+		for (const FString& Line : Lines)
+		{
+			const FString Trimmed = Line.TrimStartAndEnd();
+			if (Trimmed.StartsWith(TEXT("void IA_")))
+			{
+				const int32 ParenIndex = Trimmed.Find(TEXT("("));
+				if (ParenIndex != INDEX_NONE)
+				{
+					Declared.Add(Trimmed.Mid(5, ParenIndex - 5));
+				}
+			}
+		}
+		return Declared;
+	}
+
+	/** Inserts before the end marker, or adds a marked block after protected: or after the opening brace. */
+	static FEasyEIStubInsertion MakeDeclarationInsertion(const FString& Text, int32 BodyStart, int32 BodyEnd, const FString& Declarations)
+	{
+		const int32 EndMarkerIndex = FindInRange(Text, EndMarker, BodyStart, BodyEnd);
+		if (EndMarkerIndex != INDEX_NONE)
+		{
+			return {GetLineStart(Text, EndMarkerIndex), Declarations};
+		}
+
+		const FString Block = FString::Printf(TEXT("\t%s\n%s\t%s\n\n"), BeginMarker, *Declarations, EndMarker);
+		const int32 ProtectedIndex = FindInRange(Text, TEXT("protected:"), BodyStart, BodyEnd, ESearchCase::IgnoreCase);
+		if (ProtectedIndex != INDEX_NONE)
+		{
+			return {GetNextLineStart(Text, ProtectedIndex), Block};
+		}
+
+		return {GetNextLineStart(Text, BodyStart), TEXT("protected:\n") + Block};
+	}
+
+	static TArray<FEasyEIStubInsertion> GetSortedInsertions(const FEasyEIStubFile& File)
+	{
+		TArray<FEasyEIStubInsertion> Sorted = File.Insertions;
+		Sorted.StableSort([](const FEasyEIStubInsertion& A, const FEasyEIStubInsertion& B)
+		{
+			return A.Position < B.Position;
+		});
+		return Sorted;
+	}
+}
+
+FString FEasyEIStubFile::Apply() const
+{
+	const TArray<FEasyEIStubInsertion> Sorted = EasyEICppStubs::GetSortedInsertions(*this);
+
+	int32 NewLength = OriginalText.Len();
+	for (const FEasyEIStubInsertion& Insertion : Sorted)
+	{
+		NewLength += Insertion.Text.Len();
+	}
+
+	FString Result;
+	Result.Reserve(NewLength);
+
+	int32 Copied = 0;
+	for (const FEasyEIStubInsertion& Insertion : Sorted)
+	{
+		Result.AppendChars(*OriginalText + Copied, Insertion.Position - Copied);
+		Result += Insertion.Text;
+		Copied = Insertion.Position;
+	}
+	Result.AppendChars(*OriginalText + Copied, OriginalText.Len() - Copied);
+	return Result;
+}
+
+FString FEasyEIStubFile::MakeDiff() const
+{
+	FString RelativePath = Path;
+	FPaths::MakePathRelativeTo(RelativePath, *FPaths::RootDir());
+
+	FString Diff = FString::Printf(TEXT("--- a/%s\n+++ b/%s\n"), *RelativePath, *RelativePath);
+
+	int32 Scanned = 0;
+	int32 OldLine = 0;
+	int32 AddedLines = 0;
+	for (const FEasyEIStubInsertion& Insertion : EasyEICppStubs::GetSortedInsertions(*this))
+	{
+		for (; Scanned < Insertion.Position; ++Scanned)
+		{
+			if (OriginalText[Scanned] == TEXT('\n'))
+			{
+				++OldLine;
+			}
+		}
+
+		TArray<FString> Lines;
+		Insertion.Text.ParseIntoArray(Lines, TEXT("\n"), false);
+		if (Lines.Num() > 0 && Lines.Last().IsEmpty())
+		{
+			Lines.Pop();
+		}
+
+		Diff += FString::Printf(TEXT("@@ -%d,0 +%d,%d @@\n"), OldLine, OldLine + AddedLines + 1, Lines.Num());
+		for (const FString& Line : Lines)
+		{
+			Diff += TEXT("+") + Line + TEXT("\n");
+		}
+		AddedLines += Lines.Num();
+	}
+	return Diff;
+}
+
+bool FEasyEIStubPlan::Write() const
+{
+	bool bSuccess = true;
+	for (const FEasyEIStubFile& File : Files)
+	{
+		bSuccess &= FFileHelper::SaveStringToFile(File.Apply(), *File.Path);
+	}
+	return bSuccess;
+}
+
+FString FEasyEIStubPlan::MakeDiff() const
+{
+	FString Diff;
+	for (const FEasyEIStubFile& File : Files)
+	{
+		Diff += File.MakeDiff();
+	}
+	return Diff;
+}
+
+void FEasyEICppStubGenerator::AddClass(UClass* OwnerClass, TConstArrayView<FEasyEIBinding> Bindings, bool bBlueprintImplementable,
+                                       const UClass* ImplementingClass)
+{
+	if (!OwnerClass)
+	{
+		return;
+	}
+
+	FClassRequest* Request = Requests.FindByPredicate([OwnerClass](const FClassRequest& Existing)
+	{
+		return Existing.OwnerClass == OwnerClass;
+	});
+	if (!Request)
+	{
+		Request = &Requests.AddDefaulted_GetRef();
+		Request->OwnerClass = OwnerClass;
+		Request->bBlueprintImplementable = bBlueprintImplementable;
+	}
+
+	for (const FEasyEIBinding& Binding : Bindings)
+	{
+		// Names come from the path, so soft actions are not loaded
+		const FSoftObjectPath ActionPath = Binding.InputAction
+			                                   ? FSoftObjectPath(Binding.InputAction.Get())
+			                                   : Binding.SoftInputAction.ToSoftObjectPath();
+		if (ActionPath.IsNull())
+		{
+			continue;
+		}
+
+		const uint8 EnabledEventSlots = Binding.GetEnabledEventSlots();
+		for (int32 EventIndex = 0; EventIndex < EasyEIBindings::NumTriggerEvents; ++EventIndex)
+		{
+			if (EnabledEventSlots & (1 << EventIndex))
+			{
+				const FName HandlerName = EasyEIBindings::MakeHandlerName(ActionPath.GetAssetName(), EventIndex);
+				if (!ImplementingClass || !ImplementingClass->FindFunctionByName(HandlerName))
+				{
+					Request->HandlerNames.AddUnique(HandlerName);
+				}
+			}
+		}
+	}
+}
+
+FEasyEIStubPlan FEasyEICppStubGenerator::Plan() const
+{
+	using namespace EasyEICppStubs;
+
+	FEasyEIStubPlan Plan;
+
+	// Files are read once however many classes they contain
+	TMap<FString, int32> FileIndices;
+	auto FindOrLoadFile = [&Plan, &FileIndices](const FString& Path) -> int32
+	{
+		if (const int32* Found = FileIndices.Find(Path))
+		{
+			return *Found;
+		}
+
+		FEasyEIStubFile File;
+		File.Path = Path;
+		const int32 Index = FFileHelper::LoadFileToString(File.OriginalText, *Path) ? Plan.Files.Add(MoveTemp(File)) : INDEX_NONE;
+		FileIndices.Add(Path, Index);
+		return Index;
+	};
+
+	for (const FClassRequest& Request : Requests)
+	{
+		const bool bNeedsSource = !Request.bBlueprintImplementable;
+
+		FString HeaderPath;
+		FString SourcePath;
+		if (!FSourceCodeNavigation::FindClassHeaderPath(Request.OwnerClass, HeaderPath)
+			|| (bNeedsSource && !FSourceCodeNavigation::FindClassSourcePath(Request.OwnerClass, SourcePath)))
+		{
+			Plan.Errors.Add(FString::Printf(TEXT("Could not find source files for %s."), *Request.OwnerClass->GetName()));
+			continue;
+		}
+
+		const int32 HeaderIndex = FindOrLoadFile(FPaths::ConvertRelativePathToFull(HeaderPath));
+		const int32 SourceIndex = bNeedsSource ? FindOrLoadFile(FPaths::ConvertRelativePathToFull(SourcePath)) : INDEX_NONE;
+		if (HeaderIndex == INDEX_NONE || (bNeedsSource && SourceIndex == INDEX_NONE))
+		{
+			Plan.Errors.Add(FString::Printf(TEXT("Could not read source files for %s."), *Request.OwnerClass->GetName()));
+			continue;
+		}
+
+		const FString ClassName = FString(Request.OwnerClass->GetPrefixCPP()) + Request.OwnerClass->GetName();
+		const FString& HeaderText = Plan.Files[HeaderIndex].OriginalText;
+
+		int32 BodyStart = INDEX_NONE;
+		int32 BodyEnd = INDEX_NONE;
+		if (!FindClassBody(HeaderText, ClassName, BodyStart, BodyEnd))
+		{
+			Plan.Errors.Add(FString::Printf(TEXT("Could not find the declaration of %s in %s."), *ClassName, *HeaderPath));
+			continue;
+		}
+
+		const TSet<FString> Declared = CollectDeclaredHandlers(HeaderText.Mid(BodyStart, BodyEnd - BodyStart));
+		const FString* SourceText = bNeedsSource ? &Plan.Files[SourceIndex].OriginalText : nullptr;
+
+		FString Declarations;
+		FString Definitions;
+		for (const FName& HandlerName : Request.HandlerNames)
+		{
+			const FString FuncName = HandlerName.ToString();
+			if (Request.OwnerClass->FindFunctionByName(HandlerName) || Declared.Contains(FuncName))
+			{
+				Plan.SkippedCount++;
+				continue;
+			}
+
+			if (Request.bBlueprintImplementable)
+			{
+				Declarations += FString::Printf(
+					TEXT("\tUFUNCTION(BlueprintImplementableEvent, Category = \"Input\")\n\tvoid %s(const FInputActionValue& Value);\n\n"),
+					*FuncName);
+			}
+			else
+			{
+				Declarations += FString::Printf(TEXT("\tUFUNCTION()\n\tvoid %s(const FInputActionValue& Value);\n\n"), *FuncName);
+
+				if (!SourceText->Contains(FString::Printf(TEXT("%s::%s"), *ClassName, *FuncName)))
+				{
+					Definitions += FString::Printf(TEXT("\nvoid %s::%s(const FInputActionValue& Value)\n{\n}\n"), *ClassName, *FuncName);
+				}
+			}
+			Plan.GeneratedCount++;
+		}
+
+		if (!Declarations.IsEmpty())
+		{
+			Plan.Files[HeaderIndex].Insertions.Add(MakeDeclarationInsertion(HeaderText, BodyStart, BodyEnd, Declarations));
+		}
+		if (!Definitions.IsEmpty())
+		{
+			FEasyEIStubFile& SourceFile = Plan.Files[SourceIndex];
+			SourceFile.Insertions.Add({SourceFile.OriginalText.Len(), Definitions});
+		}
+	}
+
+	Plan.Files.RemoveAll([](const FEasyEIStubFile& File)
+	{
+		return File.Insertions.Num() == 0;
+	});
+	return Plan;
+}
@@ -0,0 +1,35 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+
+#include "EasyEIBindingsDataValidator.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "EasyEIBindingsValidation.h"
+#include "Engine/Blueprint.h"
+#include "Engine/World.h"
+
+#define LOCTEXT_NAMESPACE "EasyEIBindingsDataValidator"
+
+bool UEasyEIBindingsDataValidator::CanValidateAsset_Implementation(UObject* InAsset) const
+{
+	return InAsset && (InAsset->IsA<UBlueprint>() || InAsset->IsA<UWorld>());
+}
+
+EDataValidationResult UEasyEIBindingsDataValidator::ValidateLoadedAsset_Implementation(UObject* InAsset, TArray<FText>& ValidationErrors)
+{
+	// Tags gathered from the loaded object include unsaved edits, unlike the registry's copy
+	const FAssetData AssetData(InAsset);
+
+	FEasyEIBindingValidator Validator(FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get());
+	const TArray<FEasyEIValidationResult> Results = Validator.Validate(MakeArrayView(&AssetData, 1));
+
+	for (const FString& Handler : Results[0].MissingHandlers)
+	{
+		AssetWarning(InAsset, FText::Format(LOCTEXT("MissingHandler", "Missing input handler {0}"), FText::FromString(Handler)));
+	}
+
+	AssetPasses(InAsset);
+	return EDataValidationResult::Valid;
+}
+
+#undef LOCTEXT_NAMESPACE
@@ -1,6 +1,15 @@
 ﻿#include "EasyEIBindingsEditor.h"
 
+#include "ContentBrowserModule.h"
+#include "EasyEIBindings.h"
+#include "EasyEIBindingsBlueprintEvents.h"
 #include "EasyEIBindingsComponentDetails.h"
+#include "EasyEIBindingsValidation.h"
+#include "Editor.h"
+#include "Engine/Blueprint.h"
+#include "Framework/MultiBox/MultiBoxBuilder.h"
+#include "Misc/CoreDelegates.h"
+#include "Misc/MessageDialog.h"
 
 #define LOCTEXT_NAMESPACE "FEasyEIBindingsEditorModule"
 
@@ -9,11 +18,110 @@ void FEasyEIBindingsEditorModule::StartupModule()
 	FPropertyEditorModule& PropertyEditorModule = FModuleManager::LoadModuleChecked<FPropertyEditorModule>("PropertyEditor");
 	PropertyEditorModule.RegisterCustomClassLayout("EasyEIBindingsComponent", FOnGetDetailCustomizationInstance::CreateStatic(&FEasyEIBindingsComponentDetails::MakeInstance));
 	PropertyEditorModule.NotifyCustomizationModuleChanged();
+
+	FContentBrowserModule& ContentBrowserModule = FModuleManager::LoadModuleChecked<FContentBrowserModule>("ContentBrowser");
+	TArray<FContentBrowserMenuExtender_SelectedAssets>& AssetMenuExtenders = ContentBrowserModule.GetAllAssetViewContextMenuExtenders();
+	AssetMenuExtenders.Add(FContentBrowserMenuExtender_SelectedAssets::CreateRaw(this, &FEasyEIBindingsEditorModule::ExtendAssetContextMenu));
+	AssetContextMenuHandle = AssetMenuExtenders.Last().GetHandle();
+
+	ExtraObjectTagsHandle = UObject::FAssetRegistryTag::OnGetExtraObjectTags.AddStatic(&FEasyEIBindingValidator::AppendAssetTags);
+
+	if (GEditor)
+	{
+		HandlePostEngineInit();
+	}
+	else
+	{
+		FCoreDelegates::OnPostEngineInit.AddRaw(this, &FEasyEIBindingsEditorModule::HandlePostEngineInit);
+	}
 }
 
 void FEasyEIBindingsEditorModule::ShutdownModule()
 {
-    
+	FCoreDelegates::OnPostEngineInit.RemoveAll(this);
+	UObject::FAssetRegistryTag::OnGetExtraObjectTags.Remove(ExtraObjectTagsHandle);
+	if (FContentBrowserModule* ContentBrowserModule = FModuleManager::GetModulePtr<FContentBrowserModule>("ContentBrowser"))
+	{
+		ContentBrowserModule->GetAllAssetViewContextMenuExtenders().RemoveAll(
+			[this](const FContentBrowserMenuExtender_SelectedAssets& Delegate)
+			{
+				return Delegate.GetHandle() == AssetContextMenuHandle;
+			});
+	}
+	if (GEditor)
+	{
+		GEditor->OnBlueprintCompiled().Remove(BlueprintCompiledHandle);
+	}
+}
+
+void FEasyEIBindingsEditorModule::HandlePostEngineInit()
+{
+	if (GEditor)
+	{
+		BlueprintCompiledHandle = GEditor->OnBlueprintCompiled().AddRaw(
+			this, &FEasyEIBindingsEditorModule::HandleBlueprintCompiled);
+	}
+}
+
+void FEasyEIBindingsEditorModule::HandleBlueprintCompiled()
+{
+	// Recompiled Blueprints regenerate their functions, so resolved handlers are stale
+	FEasyEIBindingsModule::Get().GetBindingCache().Invalidate();
+}
+
+TSharedRef<FExtender> FEasyEIBindingsEditorModule::ExtendAssetContextMenu(const TArray<FAssetData>& SelectedAssets)
+{
+	TSharedRef<FExtender> Extender = MakeShared<FExtender>();
+
+	TArray<FAssetData> SelectedBlueprints;
+	for (const FAssetData& Asset : SelectedAssets)
+	{
+		if (Asset.IsInstanceOf(UBlueprint::StaticClass()))
+		{
+			SelectedBlueprints.Add(Asset);
+		}
+	}
+
+	if (SelectedBlueprints.Num() > 0)
+	{
+		Extender->AddMenuExtension(
+			"GetAssetActions", EExtensionHook::After, nullptr,
+			FMenuExtensionDelegate::CreateRaw(this, &FEasyEIBindingsEditorModule::AddBlueprintMenuEntries, SelectedBlueprints));
+	}
+	return Extender;
+}
+
+void FEasyEIBindingsEditorModule::AddBlueprintMenuEntries(FMenuBuilder& MenuBuilder, TArray<FAssetData> SelectedBlueprints)
+{
+	MenuBuilder.AddMenuEntry(
+		LOCTEXT("GenerateInputEvents", "Generate Input Action Events"),
+		LOCTEXT("GenerateInputEventsTooltip",
+		        "Adds an Enhanced Input Action event node for every action bound by an Easy EI Bindings component that the Blueprint does not handle yet."),
+		FSlateIcon(),
+		FUIAction(FExecuteAction::CreateRaw(this, &FEasyEIBindingsEditorModule::GenerateEventsForBlueprints, SelectedBlueprints)));
+}
+
+void FEasyEIBindingsEditorModule::GenerateEventsForBlueprints(TArray<FAssetData> SelectedBlueprints)
+{
+	TArray<UBlueprint*> Blueprints;
+	for (const FAssetData& Asset : SelectedBlueprints)
+	{
+		if (UBlueprint* Blueprint = Cast<UBlueprint>(Asset.GetAsset()))
+		{
+			Blueprints.Add(Blueprint);
+		}
+	}
+
+	const FEasyEIBlueprintEventsResult Result = FEasyEIBlueprintEventGenerator::GenerateBatch(Blueprints);
+
+	FMessageDialog::Open(
+		EAppMsgType::Ok,
+		FText::FromString(FString::Printf(
+			TEXT("Generated %d Enhanced Input Action node(s) in %d of %d Blueprint(s).\nSkipped %d existing node(s).%s"),
+			Result.GeneratedCount, Result.ModifiedBlueprints, Blueprints.Num(), Result.SkippedCount,
+			Result.FailedBlueprints > 0
+				? *FString::Printf(TEXT("\n%d Blueprint(s) have no Event Graph."), Result.FailedBlueprints)
+				: TEXT(""))));
 }
 
 #undef LOCTEXT_NAMESPACE
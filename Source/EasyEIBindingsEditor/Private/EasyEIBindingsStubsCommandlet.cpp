@@ -0,0 +1,157 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+
+#include "EasyEIBindingsStubsCommandlet.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "EasyEIBindingsBlueprintEvents.h"
+#include "EasyEIBindingsComponent.h"
+#include "EasyEIBindingsCppStubs.h"
+#include "Engine/Blueprint.h"
+#include "GameFramework/Actor.h"
+#include "Kismet2/BlueprintEditorUtils.h"
+#include "Misc/FileHelper.h"
+#include "UObject/UObjectIterator.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogEasyEIBindingsStubs, Log, All);
+
+UEasyEIBindingsStubsCommandlet::UEasyEIBindingsStubsCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UEasyEIBindingsStubsCommandlet::Main(const FString& Params)
+{
+	FString PathsParam = TEXT("/Game");
+	FString DiffPath;
+	FParse::Value(*Params, TEXT("Paths="), PathsParam);
+	FParse::Value(*Params, TEXT("Diff="), DiffPath);
+	const bool bDryRun = FParse::Param(*Params, TEXT("DryRun"));
+	const bool bBlueprintImplementable = FParse::Param(*Params, TEXT("BlueprintImplementable"));
+	const bool bIncludeBlueprints = FParse::Param(*Params, TEXT("IncludeBlueprints"));
+
+	FEasyEICppStubGenerator Generator;
+
+	// Native classes that configure bindings on their own components
+	for (TObjectIterator<UClass> It; It; ++It)
+	{
+		UClass* Class = *It;
+		if (!Class->HasAnyClassFlags(CLASS_Native) || !Class->IsChildOf(AActor::StaticClass()))
+		{
+			continue;
+		}
+
+		TInlineComponentArray<UEasyEIBindingsComponent*> Components(Class->GetDefaultObject<AActor>());
+		for (const UEasyEIBindingsComponent* Component : Components)
+		{
+			if (Component->InputBindings.Num() > 0)
+			{
+				Generator.AddClass(Class, Component->InputBindings, bBlueprintImplementable);
+			}
+		}
+	}
+
+	if (!bIncludeBlueprints)
+	{
+		return WritePlan(Generator, 0, bDryRun, DiffPath);
+	}
+
+	// Blueprints whose bindings need handlers on their native parent
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+	Filter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+	Filter.bRecursiveClasses = true;
+	Filter.bRecursivePaths = true;
+
+	TArray<FString> Paths;
+	PathsParam.ParseIntoArray(Paths, TEXT("+"));
+	for (const FString& Path : Paths)
+	{
+		Filter.PackagePaths.Add(FName(*Path));
+	}
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+
+	int32 NumScanned = 0;
+	for (const FAssetData& Asset : Assets)
+	{
+		// Skip loading Blueprints that cannot own components
+		FString NativeParentPath;
+		if (Asset.GetTagValue(FBlueprintTags::NativeParentClassPath, NativeParentPath))
+		{
+			const UClass* NativeParent = FindObject<UClass>(nullptr, *FPackageName::ExportTextPathToObjectPath(NativeParentPath));
+			if (NativeParent && !NativeParent->IsChildOf(AActor::StaticClass()))
+			{
+				continue;
+			}
+		}
+
+		const UBlueprint* Blueprint = Cast<UBlueprint>(Asset.GetAsset());
+		if (!Blueprint || !Blueprint->ParentClass)
+		{
+			continue;
+		}
+
+		TArray<FEasyEIBinding> Bindings;
+		FEasyEIBlueprintEventGenerator::CollectBindings(Blueprint, Bindings);
+		// Handlers the Blueprint implements itself would clash with a native function of the same name
+		if (Bindings.Num() > 0)
+		{
+			Generator.AddClass(FBlueprintEditorUtils::FindFirstNativeClass(Blueprint->ParentClass), Bindings,
+			                   bBlueprintImplementable, Blueprint->GeneratedClass);
+		}
+
+		// Handler names are recorded by AddClass, so scanned Blueprints can be released
+		if (++NumScanned % 256 == 0)
+		{
+			CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+		}
+	}
+
+	return WritePlan(Generator, Assets.Num(), bDryRun, DiffPath);
+}
+
+int32 UEasyEIBindingsStubsCommandlet::WritePlan(const FEasyEICppStubGenerator& Generator, int32 NumBlueprints, bool bDryRun,
+                                                const FString& DiffPath)
+{
+	const FEasyEIStubPlan Plan = Generator.Plan();
+	for (const FString& Error : Plan.Errors)
+	{
+		UE_LOG(LogEasyEIBindingsStubs, Warning, TEXT("%s"), *Error);
+	}
+
+	UE_LOG(LogEasyEIBindingsStubs, Display, TEXT("%d class(es), %d Blueprint(s) scanned: %d stub(s) to generate in %d file(s), %d already present."),
+	       Generator.GetNumClasses(), NumBlueprints, Plan.GeneratedCount, Plan.Files.Num(), Plan.SkippedCount);
+
+	if (bDryRun)
+	{
+		const FString Diff = Plan.MakeDiff();
+		if (!Diff.IsEmpty())
+		{
+			UE_LOG(LogEasyEIBindingsStubs, Display, TEXT("\n%s"), *Diff);
+		}
+		if (!DiffPath.IsEmpty() && !FFileHelper::SaveStringToFile(Diff, *DiffPath))
+		{
+			UE_LOG(LogEasyEIBindingsStubs, Error, TEXT("Failed to write %s."), *DiffPath);
+		}
+		return Plan.HasChanges() ? 1 : 0;
+	}
+
+	if (!Plan.Write())
+	{
+		UE_LOG(LogEasyEIBindingsStubs, Error, TEXT("Failed to write one or more files."));
+		return 1;
+	}
+
+	for (const FEasyEIStubFile& File : Plan.Files)
+	{
+		UE_LOG(LogEasyEIBindingsStubs, Display, TEXT("Updated %s."), *File.Path);
+	}
+	return 0;
+}
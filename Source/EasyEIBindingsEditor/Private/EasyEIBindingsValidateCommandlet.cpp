@@ -0,0 +1,122 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+
+#include "EasyEIBindingsValidateCommandlet.h"
+
+#include "AssetRegistry/AssetRegistryModule.h"
+#include "EasyEIBindingsTags.h"
+#include "EasyEIBindingsValidation.h"
+#include "Engine/Blueprint.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogEasyEIBindingsValidate, Log, All);
+
+UEasyEIBindingsValidateCommandlet::UEasyEIBindingsValidateCommandlet()
+{
+	IsClient = false;
+	IsEditor = true;
+	IsServer = false;
+	LogToConsole = true;
+}
+
+int32 UEasyEIBindingsValidateCommandlet::Main(const FString& Params)
+{
+	FString PathsParam = TEXT("/Game");
+	FString CacheFilename = FEasyEIBindingValidator::GetDefaultCacheFilename();
+	FParse::Value(*Params, TEXT("Paths="), PathsParam);
+	FParse::Value(*Params, TEXT("Cache="), CacheFilename);
+	const bool bUseCache = !FParse::Param(*Params, TEXT("NoCache"));
+	const bool bTaggedOnly = FParse::Param(*Params, TEXT("TaggedOnly"));
+
+	IAssetRegistry& AssetRegistry = FModuleManager::LoadModuleChecked<FAssetRegistryModule>("AssetRegistry").Get();
+	AssetRegistry.SearchAllAssets(true);
+
+	FARFilter Filter;
+	Filter.TagsAndValues.Add(EasyEIBindings::BindingsTag);
+	Filter.bRecursivePaths = true;
+
+	TArray<FString> Paths;
+	PathsParam.ParseIntoArray(Paths, TEXT("+"));
+	for (const FString& Path : Paths)
+	{
+		Filter.PackagePaths.Add(FName(*Path));
+	}
+
+	TArray<FAssetData> Assets;
+	AssetRegistry.GetAssets(Filter, Assets);
+
+	// Blueprints saved before the plugin have no tags yet. Loading them registers their classes for the
+	// handler lookups and exports fresh tags; levels and external actors still need a resave.
+	int32 NumUntagged = 0;
+	if (!bTaggedOnly)
+	{
+		FARFilter BlueprintFilter;
+		BlueprintFilter.ClassPaths.Add(UBlueprint::StaticClass()->GetClassPathName());
+		BlueprintFilter.bRecursiveClasses = true;
+		BlueprintFilter.bRecursivePaths = true;
+		BlueprintFilter.PackagePaths = Filter.PackagePaths;
+
+		TArray<FAssetData> Blueprints;
+		AssetRegistry.GetAssets(BlueprintFilter, Blueprints);
+
+		for (const FAssetData& Blueprint : Blueprints)
+		{
+			if (Blueprint.FindTag(EasyEIBindings::TaggedBlueprintTag))
+			{
+				continue;
+			}
+
+			// Asset data built from the loaded object carries the tags it would be saved with
+			if (const UBlueprint* LoadedBlueprint = Cast<UBlueprint>(Blueprint.GetAsset()))
+			{
+				Assets.RemoveAll([&Blueprint](const FAssetData& Asset) { return Asset.PackageName == Blueprint.PackageName; });
+				Assets.Emplace(LoadedBlueprint);
+				++NumUntagged;
+			}
+		}
+	}
+
+	FEasyEIBindingValidator Validator(AssetRegistry);
+	if (bUseCache)
+	{
+		Validator.LoadCache(CacheFilename);
+	}
+
+	const double StartTime = FPlatformTime::Seconds();
+	const TArray<FEasyEIValidationResult> Results = Validator.Validate(Assets);
+	const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+	int32 NumCached = 0;
+	int32 NumFailed = 0;
+	int32 NumMissing = 0;
+	for (const FEasyEIValidationResult& Result : Results)
+	{
+		NumCached += Result.bFromCache ? 1 : 0;
+		NumFailed += Result.MissingHandlers.Num() > 0 ? 1 : 0;
+		NumMissing += Result.MissingHandlers.Num();
+
+		for (const FString& Handler : Result.MissingHandlers)
+		{
+			UE_LOG(LogEasyEIBindingsValidate, Error, TEXT("%s: missing handler %s"), *Result.Asset.PackageName.ToString(), *Handler);
+		}
+		for (const FString& ClassPath : Result.UnknownClasses)
+		{
+			UE_LOG(LogEasyEIBindingsValidate, Warning, TEXT("%s: owner class %s not found, its bindings were not checked"),
+			       *Result.Asset.PackageName.ToString(), *ClassPath);
+		}
+	}
+
+	UE_LOG(LogEasyEIBindingsValidate, Display, TEXT("Validated %d asset(s) in %.1f ms, %d from cache: %d missing handler(s) in %d asset(s)."),
+	       Results.Num(), ElapsedMs, NumCached, NumMissing, NumFailed);
+	if (NumUntagged > 0)
+	{
+		UE_LOG(LogEasyEIBindingsValidate, Display, TEXT("Loaded %d Blueprint(s) without Easy EI tags, resave them to validate without loading."),
+		       NumUntagged);
+	}
+
+	if (bUseCache && !Validator.SaveCache(CacheFilename))
+	{
+		UE_LOG(LogEasyEIBindingsValidate, Warning, TEXT("Failed to write %s."), *CacheFilename);
+	}
+
+	return NumFailed > 0 ? 1 : 0;
+}
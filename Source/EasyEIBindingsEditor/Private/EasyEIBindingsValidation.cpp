@@ -0,0 +1,295 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+
+#include "EasyEIBindingsValidation.h"
+
+#include "AssetRegistry/IAssetRegistry.h"
+#include "Async/ParallelFor.h"
+#include "EasyEIBindingsBlueprintEvents.h"
+#include "EasyEIBindingsComponent.h"
+#include "EasyEIBindingsTags.h"
+#include "Engine/Blueprint.h"
+#include "Engine/Level.h"
+#include "Engine/World.h"
+#include "GameFramework/Actor.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+namespace EasyEIBindingValidation
+{
+	static void AppendActorEntries(const AActor* Actor, TArray<FString>& OutEntries)
+	{
+		TInlineComponentArray<UEasyEIBindingsComponent*> Components(Actor);
+		for (const UEasyEIBindingsComponent* Component : Components)
+		{
+			Component->AppendBindingTagEntries(OutEntries);
+		}
+	}
+
+	static void GatherHandlers(const UClass* Class, TArray<FName>& OutHandlers)
+	{
+		for (TFieldIterator<UFunction> It(Class, EFieldIteratorFlags::IncludeSuper); It; ++It)
+		{
+			if (It->GetName().StartsWith(TEXT("IA_"), ESearchCase::CaseSensitive))
+			{
+				OutHandlers.Add(It->GetFName());
+			}
+		}
+	}
+}
+
+FEasyEIBindingValidator::FEasyEIBindingValidator(IAssetRegistry& InAssetRegistry)
+	: AssetRegistry(InAssetRegistry)
+{
+}
+
+const FEasyEIBindingValidator::FClassHandlers& FEasyEIBindingValidator::FindOrResolveClass(const FString& ClassPath)
+{
+	check(IsInGameThread());
+
+	if (const FClassHandlers* Found = ClassHandlers.Find(ClassPath))
+	{
+		return *Found;
+	}
+
+	FClassHandlers& Entry = ClassHandlers.Add(ClassPath);
+	TArray<FName> Handlers;
+
+	// Loaded classes, including every native class, are authoritative
+	if (const UClass* Class = FindObject<UClass>(nullptr, *ClassPath))
+	{
+		EasyEIBindingValidation::GatherHandlers(Class, Handlers);
+		Entry.bFound = true;
+	}
+	else
+	{
+		// Unloaded Blueprint classes are read from their asset's tag, /Path/BP_X.BP_X_C lives in /Path/BP_X.BP_X
+		FString AssetPath = ClassPath;
+		AssetPath.RemoveFromEnd(TEXT("_C"));
+
+		FString HandlersValue;
+		const FAssetData ClassAsset = AssetRegistry.GetAssetByObjectPath(FSoftObjectPath(AssetPath));
+		if (ClassAsset.IsValid())
+		{
+			Entry.bFound = true;
+			if (ClassAsset.GetTagValue(EasyEIBindings::HandlersTag, HandlersValue))
+			{
+				TArray<FString> Names;
+				HandlersValue.ParseIntoArray(Names, TEXT(","));
+				for (const FString& Name : Names)
+				{
+					Handlers.Add(FName(*Name));
+				}
+			}
+		}
+	}
+
+	Handlers.Sort(FNameLexicalLess());
+	for (const FName& Handler : Handlers)
+	{
+		Entry.Handlers.Add(Handler);
+		Entry.Hash = HashCombine(Entry.Hash, FCrc::StrCrc32(*Handler.ToString()));
+	}
+	Entry.Hash = HashCombine(Entry.Hash, Entry.bFound ? 1u : 0u);
+	return Entry;
+}
+
+TArray<FEasyEIValidationResult> FEasyEIBindingValidator::Validate(TConstArrayView<FAssetData> Assets)
+{
+	const int32 NumAssets = Assets.Num();
+
+	TArray<FEasyEIValidationResult> Results;
+	Results.SetNum(NumAssets);
+	TArray<FString> TagValues;
+	TagValues.SetNum(NumAssets);
+	TArray<TArray<FEasyEIBindingTagEntry>> Entries;
+	Entries.SetNum(NumAssets);
+
+	ParallelFor(NumAssets, [&](int32 Index)
+	{
+		Results[Index].Asset = Assets[Index];
+		if (Assets[Index].GetTagValue(EasyEIBindings::BindingsTag, TagValues[Index]))
+		{
+			Entries[Index] = FEasyEIBindingTagEntry::ParseList(TagValues[Index]);
+		}
+	});
+
+	// Class lookups touch UObjects and the registry, so they stay on this thread
+	for (const TArray<FEasyEIBindingTagEntry>& AssetEntries : Entries)
+	{
+		for (const FEasyEIBindingTagEntry& Entry : AssetEntries)
+		{
+			FindOrResolveClass(Entry.OwnerClassPath);
+		}
+	}
+
+	TArray<uint32> Hashes;
+	Hashes.SetNumZeroed(NumAssets);
+
+	ParallelFor(NumAssets, [&](int32 Index)
+	{
+		if (Entries[Index].Num() == 0)
+		{
+			return;
+		}
+
+		// Bindings and the owners' handlers are the only inputs, so an unchanged hash means an unchanged result
+		uint32 Hash = FCrc::StrCrc32(*TagValues[Index]);
+		for (const FEasyEIBindingTagEntry& Entry : Entries[Index])
+		{
+			Hash = HashCombine(Hash, ClassHandlers.FindChecked(Entry.OwnerClassPath).Hash);
+		}
+		Hashes[Index] = Hash;
+
+		FEasyEIValidationResult& Result = Results[Index];
+		const FCacheEntry* Cached = Cache.Find(Assets[Index].PackageName);
+		if (Cached && Cached->Hash == Hash)
+		{
+			Result.MissingHandlers = Cached->MissingHandlers;
+			Result.UnknownClasses = Cached->UnknownClasses;
+			Result.bFromCache = true;
+			return;
+		}
+
+		for (const FEasyEIBindingTagEntry& Entry : Entries[Index])
+		{
+			const FClassHandlers& Owner = ClassHandlers.FindChecked(Entry.OwnerClassPath);
+			if (!Owner.bFound)
+			{
+				Result.UnknownClasses.AddUnique(Entry.OwnerClassPath);
+				continue;
+			}
+
+			for (const FName& Handler : Entry.HandlerNames)
+			{
+				if (!Owner.Handlers.Contains(Handler))
+				{
+					Result.MissingHandlers.AddUnique(FString::Printf(
+						TEXT("%s::%s"), *FSoftObjectPath(Entry.OwnerClassPath).GetAssetName(), *Handler.ToString()));
+				}
+			}
+		}
+	});
+
+	for (int32 Index = 0; Index < NumAssets; ++Index)
+	{
+		if (Hashes[Index] != 0 && !Results[Index].bFromCache)
+		{
+			FCacheEntry& Entry = Cache.Add(Assets[Index].PackageName);
+			Entry.Hash = Hashes[Index];
+			Entry.MissingHandlers = Results[Index].MissingHandlers;
+			Entry.UnknownClasses = Results[Index].UnknownClasses;
+		}
+	}
+	return Results;
+}
+
+bool FEasyEIBindingValidator::LoadCache(const FString& Filename)
+{
+	TArray<FString> Lines;
+	if (!FFileHelper::LoadFileToStringArray(Lines, *Filename))
+	{
+		return false;
+	}
+
+	// PackageName, hash, missing handlers and unknown classes, tab separated
+	for (const FString& Line : Lines)
+	{
+		TArray<FString> Fields;
+		Line.ParseIntoArray(Fields, TEXT("\t"), false);
+		if (Fields.Num() != 4)
+		{
+			continue;
+		}
+
+		FCacheEntry& Entry = Cache.Add(FName(*Fields[0]));
+		Entry.Hash = static_cast<uint32>(FCString::Strtoui64(*Fields[1], nullptr, 10));
+		Fields[2].ParseIntoArray(Entry.MissingHandlers, TEXT(","));
+		Fields[3].ParseIntoArray(Entry.UnknownClasses, TEXT(","));
+	}
+	return true;
+}
+
+bool FEasyEIBindingValidator::SaveCache(const FString& Filename) const
+{
+	TStringBuilder<4096> Text;
+	for (const TPair<FName, FCacheEntry>& Pair : Cache)
+	{
+		Text.Appendf(TEXT("%s\t%u\t%s\t%s\n"), *Pair.Key.ToString(), Pair.Value.Hash,
+		             *FString::Join(Pair.Value.MissingHandlers, TEXT(",")),
+		             *FString::Join(Pair.Value.UnknownClasses, TEXT(",")));
+	}
+	return FFileHelper::SaveStringToFile(Text.ToView(), *Filename);
+}
+
+FString FEasyEIBindingValidator::GetDefaultCacheFilename()
+{
+	return FPaths::ProjectSavedDir() / TEXT("EasyEIBindings") / TEXT("ValidationCache.txt");
+}
+
+void FEasyEIBindingValidator::AppendAssetTags(const UObject* Object, TArray<UObject::FAssetRegistryTag>& OutTags)
+{
+	using namespace EasyEIBindingValidation;
+
+	TArray<FString> Entries;
+
+	if (const UBlueprint* Blueprint = Cast<UBlueprint>(Object))
+	{
+		if (!Blueprint->GeneratedClass)
+		{
+			return;
+		}
+
+		// Inherited templates are checked against this class, which may implement handlers its parent does not
+		TArray<const UEasyEIBindingsComponent*> Components;
+		FEasyEIBlueprintEventGenerator::CollectComponents(Blueprint, Components);
+		for (const UEasyEIBindingsComponent* Component : Components)
+		{
+			Component->AppendBindingTagEntries(Entries, Blueprint->GeneratedClass);
+		}
+
+		// Empty tags are not stored, so a marker tells "no bindings" apart from "saved before the plugin"
+		OutTags.Add(UObject::FAssetRegistryTag(EasyEIBindings::TaggedBlueprintTag, TEXT("1"), UObject::FAssetRegistryTag::TT_Hidden));
+
+		// Lets levels and child Blueprints be checked against this class without loading it
+		TArray<FName> Handlers;
+		GatherHandlers(Blueprint->GeneratedClass, Handlers);
+		if (Handlers.Num() > 0)
+		{
+			TArray<FString> HandlerStrings;
+			for (const FName& Handler : Handlers)
+			{
+				HandlerStrings.Add(Handler.ToString());
+			}
+			OutTags.Add(UObject::FAssetRegistryTag(EasyEIBindings::HandlersTag, FString::Join(HandlerStrings, TEXT(",")),
+			                                       UObject::FAssetRegistryTag::TT_Hidden));
+		}
+	}
+	else if (const UWorld* World = Cast<UWorld>(Object))
+	{
+		if (World->PersistentLevel)
+		{
+			for (const AActor* Actor : World->PersistentLevel->Actors)
+			{
+				// Actors saved in their own packages export their own tags
+				if (Actor && !Actor->IsPackageExternal())
+				{
+					AppendActorEntries(Actor, Entries);
+				}
+			}
+		}
+	}
+	else if (const AActor* Actor = Cast<AActor>(Object))
+	{
+		if (Actor->IsPackageExternal())
+		{
+			AppendActorEntries(Actor, Entries);
+		}
+	}
+
+	if (Entries.Num() > 0)
+	{
+		OutTags.Add(UObject::FAssetRegistryTag(EasyEIBindings::BindingsTag, FEasyEIBindingTagEntry::JoinList(Entries),
+		                                       UObject::FAssetRegistryTag::TT_Hidden));
+	}
+}
@@ -0,0 +1,370 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+
+#include "SEasyEIBindingTable.h"
+
+#include "EasyEIBindingsCache.h"
+#include "EasyEIBindingsComponent.h"
+#include "InputAction.h"
+#include "PropertyHandle.h"
+#include "ScopedTransaction.h"
+#include "Styling/CoreStyle.h"
+#include "Widgets/Images/SImage.h"
+#include "Widgets/Input/SCheckBox.h"
+#include "Widgets/Input/SSearchBox.h"
+#include "Widgets/Layout/SBox.h"
+#include "Widgets/Text/STextBlock.h"
+#include "Widgets/Views/STableRow.h"
+
+#define LOCTEXT_NAMESPACE "EasyEIBindingTable"
+
+namespace EasyEIBindingTable
+{
+	static const FName StatusColumn(TEXT("Status"));
+	static const FName ActionColumn(TEXT("Action"));
+
+	/** Event slot shown by the column, INDEX_NONE for the status and action columns. */
+	static int32 GetColumnEventIndex(const FName& ColumnId)
+	{
+		for (int32 EventIndex = 0; EventIndex < EasyEIBindings::NumTriggerEvents; ++EventIndex)
+		{
+			if (ColumnId == EasyEIBindings::GetTriggerEventSuffix(EventIndex))
+			{
+				return EventIndex;
+			}
+		}
+		return INDEX_NONE;
+	}
+}
+
+/**
+ * One binding of the table. Widgets read the component through the table, so rows stay valid across edits.
+ */
+class SEasyEIBindingTableRow : public SMultiColumnTableRow<SEasyEIBindingTable::FItemPtr>
+{
+public:
+	SLATE_BEGIN_ARGS(SEasyEIBindingTableRow)
+		{
+		}
+	SLATE_END_ARGS()
+
+	void Construct(const FArguments& InArgs, const TSharedRef<STableViewBase>& InOwnerTable,
+	               TSharedRef<SEasyEIBindingTable> InTable, SEasyEIBindingTable::FItemPtr InItem)
+	{
+		Table = InTable;
+		Item = InItem;
+		SMultiColumnTableRow::Construct(FSuperRowType::FArguments(), InOwnerTable);
+	}
+
+	virtual TSharedRef<SWidget> GenerateWidgetForColumn(const FName& ColumnName) override
+	{
+		using namespace EasyEIBindingTable;
+
+		const TWeakPtr<SEasyEIBindingTable> WeakTable = Table;
+		const SEasyEIBindingTable::FItemPtr RowItem = Item;
+
+		if (ColumnName == StatusColumn)
+		{
+			return SNew(SBox)
+				.HAlign(HAlign_Center)
+				.VAlign(VAlign_Center)
+				[
+					SNew(SBox)
+					.WidthOverride(8)
+					.HeightOverride(8)
+					[
+						SNew(SImage)
+						.Image(FCoreStyle::Get().GetBrush("GenericWhiteBox"))
+						.ColorAndOpacity_Lambda([WeakTable, RowItem]()
+						{
+							const TSharedPtr<SEasyEIBindingTable> PinnedTable = WeakTable.Pin();
+							const FEasyEIBindingRowStatus* Status = PinnedTable.IsValid() ? PinnedTable->FindRowStatus(RowItem->BindingIndex) : nullptr;
+							return FSlateColor(Status ? Status->GetIndicatorColor() : FLinearColor::Transparent);
+						})
+						.ToolTipText_Lambda([WeakTable, RowItem]()
+						{
+							const TSharedPtr<SEasyEIBindingTable> PinnedTable = WeakTable.Pin();
+							const FEasyEIBindingRowStatus* Status = PinnedTable.IsValid() ? PinnedTable->FindRowStatus(RowItem->BindingIndex) : nullptr;
+							return Status ? Status->ToolTip : LOCTEXT("RowStatusPending", "Checking handlers...");
+						})
+					]
+				];
+		}
+
+		if (ColumnName == ActionColumn)
+		{
+			return SNew(SBox)
+				.VAlign(VAlign_Center)
+				.Padding(4, 0)
+				[
+					SNew(STextBlock)
+					.Text(FText::FromString(RowItem->ActionName))
+				];
+		}
+
+		const int32 EventIndex = GetColumnEventIndex(ColumnName);
+		if (EventIndex == INDEX_NONE)
+		{
+			return SNullWidget::NullWidget;
+		}
+
+		return SNew(SBox)
+			.HAlign(HAlign_Center)
+			.VAlign(VAlign_Center)
+			[
+				SNew(SCheckBox)
+				.IsChecked_Lambda([WeakTable, RowItem, EventIndex]()
+				{
+					const TSharedPtr<SEasyEIBindingTable> PinnedTable = WeakTable.Pin();
+					return PinnedTable.IsValid() ? PinnedTable->GetEventState(RowItem, EventIndex) : ECheckBoxState::Undetermined;
+				})
+				.OnCheckStateChanged_Lambda([WeakTable, RowItem, EventIndex](ECheckBoxState NewState)
+				{
+					if (const TSharedPtr<SEasyEIBindingTable> PinnedTable = WeakTable.Pin())
+					{
+						PinnedTable->SetEventState(NewState, RowItem, EventIndex);
+					}
+				})
+			];
+	}
+
+private:
+	TWeakPtr<SEasyEIBindingTable> Table;
+	SEasyEIBindingTable::FItemPtr Item;
+};
+
+void SEasyEIBindingTable::Construct(const FArguments& InArgs, UEasyEIBindingsComponent* InComponent,
+                                    TSharedRef<IPropertyHandle> InBindingsHandle)
+{
+	using namespace EasyEIBindingTable;
+
+	Component = InComponent;
+	BindingsHandle = InBindingsHandle;
+	OnGetRowStatus = InArgs._OnGetRowStatus;
+
+	const TSharedRef<SHeaderRow> HeaderRow = SNew(SHeaderRow)
+		+ SHeaderRow::Column(StatusColumn)
+		  .DefaultLabel(FText::GetEmpty())
+		  .DefaultTooltip(LOCTEXT("StatusColumnToolTip", "Handler resolution status"))
+		  .FixedWidth(24)
+		  .SortMode(this, &SEasyEIBindingTable::GetSortMode, StatusColumn)
+		  .OnSort(this, &SEasyEIBindingTable::OnSortModeChanged)
+		+ SHeaderRow::Column(ActionColumn)
+		  .DefaultLabel(LOCTEXT("ActionColumn", "Input Action"))
+		  .FillWidth(1.f)
+		  .SortMode(this, &SEasyEIBindingTable::GetSortMode, ActionColumn)
+		  .OnSort(this, &SEasyEIBindingTable::OnSortModeChanged);
+
+	for (int32 EventIndex = 0; EventIndex < EasyEIBindings::NumTriggerEvents; ++EventIndex)
+	{
+		const TCHAR* Suffix = EasyEIBindings::GetTriggerEventSuffix(EventIndex);
+		HeaderRow->AddColumn(SHeaderRow::Column(Suffix)
+		                     .DefaultLabel(FText::FromString(Suffix))
+		                     .FixedWidth(72)
+		                     .HAlignHeader(HAlign_Center)
+		                     .HAlignCell(HAlign_Center));
+	}
+
+	ChildSlot
+	[
+		SNew(SVerticalBox)
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		.Padding(0, 2)
+		[
+			SNew(SHorizontalBox)
+			+ SHorizontalBox::Slot()
+			.FillWidth(1)
+			[
+				SNew(SSearchBox)
+				.HintText(LOCTEXT("FilterHint", "Filter Input Actions"))
+				.OnTextChanged(this, &SEasyEIBindingTable::OnFilterTextChanged)
+			]
+			+ SHorizontalBox::Slot()
+			.AutoWidth()
+			.VAlign(VAlign_Center)
+			.Padding(8, 0, 4, 0)
+			[
+				SNew(STextBlock)
+				.Text(this, &SEasyEIBindingTable::GetCountText)
+			]
+		]
+		+ SVerticalBox::Slot()
+		.AutoHeight()
+		[
+			SNew(SBox)
+			.MaxDesiredHeight(400)
+			[
+				SAssignNew(ListView, SListView<FItemPtr>)
+				.ListItemsSource(&FilteredItems)
+				.SelectionMode(ESelectionMode::Multi)
+				.OnGenerateRow(this, &SEasyEIBindingTable::GenerateRow)
+				.HeaderRow(HeaderRow)
+			]
+		]
+	];
+
+	RefreshItems();
+}
+
+void SEasyEIBindingTable::RefreshItems()
+{
+	const UEasyEIBindingsComponent* Comp = Component.Get();
+	const int32 NumBindings = Comp ? Comp->InputBindings.Num() : 0;
+
+	// Items are kept per binding index so the selection survives edits
+	if (AllItems.Num() > NumBindings)
+	{
+		AllItems.SetNum(NumBindings);
+	}
+	while (AllItems.Num() < NumBindings)
+	{
+		const TSharedRef<FItem> Item = MakeShared<FItem>();
+		Item->BindingIndex = AllItems.Num();
+		AllItems.Add(Item);
+	}
+
+	for (int32 BindingIndex = 0; BindingIndex < NumBindings; ++BindingIndex)
+	{
+		const FEasyEIBinding& Binding = Comp->InputBindings[BindingIndex];
+
+		// Soft actions are named from their path so listing them never loads the asset
+		AllItems[BindingIndex]->ActionName = Binding.InputAction
+			                                     ? Binding.InputAction->GetName()
+			                                     : !Binding.SoftInputAction.IsNull()
+			                                     ? Binding.SoftInputAction.GetAssetName()
+			                                     : TEXT("None");
+	}
+
+	ApplyFilterAndSort();
+}
+
+const FEasyEIBindingRowStatus* SEasyEIBindingTable::FindRowStatus(int32 BindingIndex) const
+{
+	return OnGetRowStatus.IsBound() ? OnGetRowStatus.Execute(BindingIndex) : nullptr;
+}
+
+ECheckBoxState SEasyEIBindingTable::GetEventState(FItemPtr Item, int32 EventIndex) const
+{
+	const UEasyEIBindingsComponent* Comp = Component.Get();
+	if (!Comp || !Item.IsValid() || !Comp->InputBindings.IsValidIndex(Item->BindingIndex))
+	{
+		return ECheckBoxState::Undetermined;
+	}
+
+	return Comp->InputBindings[Item->BindingIndex].IsEventEnabled(EasyEIBindings::GetTriggerEvent(EventIndex))
+		       ? ECheckBoxState::Checked
+		       : ECheckBoxState::Unchecked;
+}
+
+void SEasyEIBindingTable::SetEventState(ECheckBoxState NewState, FItemPtr Item, int32 EventIndex)
+{
+	UEasyEIBindingsComponent* Comp = Component.Get();
+	if (!Comp || !Item.IsValid() || !BindingsHandle.IsValid())
+	{
+		return;
+	}
+
+	TArray<FItemPtr> Targets;
+	if (ListView->IsItemSelected(Item))
+	{
+		Targets = ListView->GetSelectedItems();
+	}
+	else
+	{
+		Targets.Add(Item);
+	}
+
+	const ETriggerEvent Event = EasyEIBindings::GetTriggerEvent(EventIndex);
+	const bool bEnabled = NewState == ECheckBoxState::Checked;
+
+	// One transaction and one change notification for the whole selection
+	const FScopedTransaction Transaction(LOCTEXT("SetBindingEvents", "Set Binding Events"));
+	BindingsHandle->NotifyPreChange();
+	for (const FItemPtr& Target : Targets)
+	{
+		if (Comp->InputBindings.IsValidIndex(Target->BindingIndex))
+		{
+			Comp->InputBindings[Target->BindingIndex].SetEventEnabled(Event, bEnabled);
+		}
+	}
+	BindingsHandle->NotifyPostChange(EPropertyChangeType::ValueSet);
+}
+
+TSharedRef<ITableRow> SEasyEIBindingTable::GenerateRow(FItemPtr Item, const TSharedRef<STableViewBase>& OwnerTable)
+{
+	return SNew(SEasyEIBindingTableRow, OwnerTable, SharedThis(this), Item);
+}
+
+void SEasyEIBindingTable::OnFilterTextChanged(const FText& InFilterText)
+{
+	FilterText = InFilterText.ToString();
+	ApplyFilterAndSort();
+}
+
+void SEasyEIBindingTable::OnSortModeChanged(EColumnSortPriority::Type SortPriority, const FName& ColumnId,
+                                            EColumnSortMode::Type InSortMode)
+{
+	SortColumn = ColumnId;
+	SortMode = InSortMode;
+	ApplyFilterAndSort();
+}
+
+EColumnSortMode::Type SEasyEIBindingTable::GetSortMode(FName ColumnId) const
+{
+	return ColumnId == SortColumn ? SortMode : EColumnSortMode::None;
+}
+
+void SEasyEIBindingTable::ApplyFilterAndSort()
+{
+	FilteredItems.Reset();
+	for (const FItemPtr& Item : AllItems)
+	{
+		if (FilterText.IsEmpty() || Item->ActionName.Contains(FilterText))
+		{
+			FilteredItems.Add(Item);
+		}
+	}
+
+	if (SortMode != EColumnSortMode::None)
+	{
+		const bool bAscending = SortMode == EColumnSortMode::Ascending;
+		if (SortColumn == EasyEIBindingTable::StatusColumn)
+		{
+			// Rows still being resolved sort before every resolved row
+			TMap<int32, int32> MissingCounts;
+			for (const FItemPtr& Item : FilteredItems)
+			{
+				const FEasyEIBindingRowStatus* Status = FindRowStatus(Item->BindingIndex);
+				MissingCounts.Add(Item->BindingIndex, Status ? Status->GetNumMissing() : -1);
+			}
+
+			FilteredItems.StableSort([&MissingCounts, bAscending](const FItemPtr& A, const FItemPtr& B)
+			{
+				const int32 MissingA = MissingCounts.FindChecked(A->BindingIndex);
+				const int32 MissingB = MissingCounts.FindChecked(B->BindingIndex);
+				return bAscending ? MissingA < MissingB : MissingA > MissingB;
+			});
+		}
+		else
+		{
+			FilteredItems.StableSort([bAscending](const FItemPtr& A, const FItemPtr& B)
+			{
+				const int32 Compare = A->ActionName.Compare(B->ActionName, ESearchCase::IgnoreCase);
+				return bAscending ? Compare < 0 : Compare > 0;
+			});
+		}
+	}
+
+	if (ListView.IsValid())
+	{
+		ListView->RequestListRefresh();
+	}
+}
+
+FText SEasyEIBindingTable::GetCountText() const
+{
+	return FText::Format(LOCTEXT("CountText", "{0} of {1}"), FilteredItems.Num(), AllItems.Num());
+}
+
+#undef LOCTEXT_NAMESPACE
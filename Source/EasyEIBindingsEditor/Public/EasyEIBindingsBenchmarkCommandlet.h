@@ -0,0 +1,55 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "GameFramework/Actor.h"
+#include "InputActionValue.h"
+#include "EasyEIBindingsBenchmarkCommandlet.generated.h"
+
+/**
+ * Owner spawned by the benchmark. Every benchmark action is named IA_Bench, so these handlers serve all of them.
+ */
+UCLASS(NotPlaceable, Transient, HideDropdown)
+class AEasyEIBindingsBenchmarkActor : public AActor
+{
+	GENERATED_BODY()
+
+public:
+	UFUNCTION()
+	void IA_Bench_Triggered(const FInputActionValue& Value) { ++HandledCount; }
+
+	UFUNCTION()
+	void IA_Bench_Started(const FInputActionValue& Value) { ++HandledCount; }
+
+	UFUNCTION()
+	void IA_Bench_Ongoing(const FInputActionValue& Value) { ++HandledCount; }
+
+	UFUNCTION()
+	void IA_Bench_Completed(const FInputActionValue& Value) { ++HandledCount; }
+
+	UFUNCTION()
+	void IA_Bench_Canceled(const FInputActionValue& Value) { ++HandledCount; }
+
+	int64 HandledCount = 0;
+};
+
+/**
+ * Measures SetupInputActions, RebindInputActions, ClearInputBindings and per-event dispatch headlessly.
+ *
+ * UnrealEditor-Cmd <Project> -run=EasyEIBindingsBenchmark -nullrhi [-Actors=100] [-Actions=16]
+ *     [-Iterations=5] [-Dispatches=10] [-Dispatch] [-Output=<Dir>]
+ *
+ * -Dispatch benchmarks component dispatch instead of by-name binding. Results are written as CSV and JSON.
+ */
+UCLASS()
+class UEasyEIBindingsBenchmarkCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UEasyEIBindingsBenchmarkCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,56 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UBlueprint;
+class UInputAction;
+class UEasyEIBindingsComponent;
+class UK2Node_EnhancedInputAction;
+struct FEasyEIBinding;
+
+/**
+ * Outcome of generating Enhanced Input Action event nodes in one or more Blueprints.
+ */
+struct FEasyEIBlueprintEventsResult
+{
+	int32 GeneratedCount = 0;
+	int32 SkippedCount = 0;
+
+	// Blueprints that received at least one node
+	int32 ModifiedBlueprints = 0;
+
+	// Blueprints without an event graph to add nodes to
+	int32 FailedBlueprints = 0;
+};
+
+/**
+ * Adds an Enhanced Input Action event node for every bound action a Blueprint does not handle yet.
+ * Existing nodes are indexed once across all ubergraph pages, missing nodes are added to the
+ * event graph in a single batch with one structural modification per Blueprint.
+ */
+class FEasyEIBlueprintEventGenerator
+{
+public:
+	/** Generates nodes for the actions of the given bindings. */
+	static FEasyEIBlueprintEventsResult Generate(UBlueprint* Blueprint, TConstArrayView<FEasyEIBinding> Bindings);
+
+	/** Generates nodes for every EasyEIBindingsComponent the Blueprint defines or inherits. */
+	static FEasyEIBlueprintEventsResult Generate(UBlueprint* Blueprint);
+
+	/** Runs Generate over each Blueprint in one transaction. */
+	static FEasyEIBlueprintEventsResult GenerateBatch(TConstArrayView<UBlueprint*> Blueprints);
+
+	/** Appends the bindings of every EasyEIBindingsComponent the Blueprint defines or inherits. */
+	static void CollectBindings(const UBlueprint* Blueprint, TArray<FEasyEIBinding>& OutBindings);
+
+	/**
+	 * Appends every EasyEIBindingsComponent template the Blueprint's actors are built from: its own construction script,
+	 * the construction scripts of parent Blueprints with this Blueprint's overrides applied, and native default subobjects.
+	 */
+	static void CollectComponents(const UBlueprint* Blueprint, TArray<const UEasyEIBindingsComponent*>& OutComponents);
+
+	/** Actions that already have an event node in any ubergraph page of the Blueprint. */
+	static TSet<const UInputAction*> IndexExistingEvents(const UBlueprint* Blueprint);
+};
@@ -3,12 +3,16 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Containers/Ticker.h"
 #include "IDetailCustomization.h"
+#include "SEasyEIBindingTable.h"
 
 class UEasyEIBindingsComponent;
 class IDetailCategoryBuilder;
+class IDetailChildrenBuilder;
+class IPropertyHandle;
 class UBlueprint;
-struct FBindingStatus;
+struct FAssetData;
 
 /**
  * Custom details panel for EasyEIBindingsComponent.
@@ -22,24 +26,66 @@ public:
 		return MakeShareable(new FEasyEIBindingsComponentDetails);
 	}
 
+	virtual ~FEasyEIBindingsComponentDetails() override;
+
 	virtual void CustomizeDetails(IDetailLayoutBuilder& DetailBuilder) override;
 
 private:
 	FReply OnCreateInputAction();
 	FReply OnAddFromFolder();
+	FReply OnSyncWithFolder();
 	FReply GenerateStubs();
 	FReply GenerateBlueprintStubs();
 
+	/**
+	 * Adds bindings for assets not bound yet, in one transaction and without loading them.
+	 * When SyncFolder is set, also removes bindings to actions under it that are not in Assets.
+	 */
+	void ApplyFolderBindings(const TArray<FAssetData>& Assets, const FString& SyncFolder, const FText& TransactionText);
+
 	void GenerateCPPStubs(UClass* OwnerClass, bool bBlueprintImplementable);
 
 	void GenerateBlueprintEvents(UBlueprint* Blueprint);
 
 	void AddBindingStatusWidget(IDetailCategoryBuilder& Category);
 
-	void GatherBindingStatuses(TArray<FBindingStatus>& OutStatuses);
+	void GenerateBindingRow(TSharedRef<IPropertyHandle> ElementHandle, int32 ArrayIndex, IDetailChildrenBuilder& ChildrenBuilder);
+
+	void OnInputBindingsChanged();
+
+	/** Rebuilds row statuses from the shared handler status cache, scheduling actions it misses on the editor ticker. */
+	void RequestStatusRefresh();
+
+	/** Resolves a budgeted slice of uncached actions per tick, returns false once every row is up to date. */
+	bool TickStatusRefresh(float DeltaTime);
+
+	/** Whether the status snapshot predates an edit, Blueprint compile or reload. */
+	bool IsStatusStale() const;
 
-	static bool DoesFunctionExist(UClass* OwnerClass, const FString& FunctionName);
+	/** Cached status of a binding, null while it is being recomputed. Requests a refresh when the snapshot is stale. */
+	const FEasyEIBindingRowStatus* FindRowStatus(int32 ArrayIndex);
+
+	// Attribute getters, each requests a refresh when the snapshot is stale
+	FText GetStatusText();
+	FSlateColor GetStatusColor();
+	FSlateColor GetRowStatusColor(int32 ArrayIndex);
+	FText GetRowStatusToolTip(int32 ArrayIndex);
 
 	TWeakObjectPtr<UEasyEIBindingsComponent> OwnerComponent;
+	TSharedPtr<IPropertyHandle> InputBindingsHandle;
 	UClass* CachedOwnerClass = nullptr;
+
+	TArray<FEasyEIBindingRowStatus> RowStatuses;
+
+	// Next binding to resolve while a refresh is in progress, INDEX_NONE when idle
+	int32 NextStatusRow = INDEX_NONE;
+
+	// Binding cache generation the snapshot was computed against
+	uint32 StatusGeneration = 0;
+	bool bStatusValid = false;
+
+	FTSTicker::FDelegateHandle StatusRefreshHandle;
+
+	// Set when InputBindings is shown as a table rather than property rows
+	TSharedPtr<SEasyEIBindingTable> BindingTable;
 };
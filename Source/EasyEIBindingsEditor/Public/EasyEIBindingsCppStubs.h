@@ -0,0 +1,85 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+class UClass;
+struct FEasyEIBinding;
+
+/**
+ * Text inserted into a source file at an offset of its original contents.
+ */
+struct FEasyEIStubInsertion
+{
+	int32 Position = 0;
+	FString Text;
+};
+
+/**
+ * Pending edits to one header or source file. Insertions are relative to the original text,
+ * so they are applied together in a single pass.
+ */
+struct FEasyEIStubFile
+{
+	FString Path;
+	FString OriginalText;
+	TArray<FEasyEIStubInsertion> Insertions;
+
+	/** Original text with every insertion applied. */
+	FString Apply() const;
+
+	/** Unified diff of the insertions without context lines, as produced by diff -U0. */
+	FString MakeDiff() const;
+};
+
+/**
+ * Every file edit needed to declare and define the missing handlers of the added classes.
+ */
+struct FEasyEIStubPlan
+{
+	TArray<FEasyEIStubFile> Files;
+
+	int32 GeneratedCount = 0;
+	int32 SkippedCount = 0;
+
+	// Classes whose header, source or declaration could not be found
+	TArray<FString> Errors;
+
+	bool HasChanges() const { return Files.Num() > 0; }
+
+	/** Writes each changed file once. Returns false if any write failed. */
+	bool Write() const;
+
+	FString MakeDiff() const;
+};
+
+/**
+ * Plans C++ handler stubs for native owner classes. Classes are gathered first, then every
+ * header and source is read once and all missing declarations and definitions for it are
+ * computed in one pass.
+ */
+class FEasyEICppStubGenerator
+{
+public:
+	/**
+	 * Adds the handlers the bindings need on the class. Adding a class again merges the handlers.
+	 * Handlers ImplementingClass already resolves, e.g. events of the Blueprint the bindings come from, are left out.
+	 */
+	void AddClass(UClass* OwnerClass, TConstArrayView<FEasyEIBinding> Bindings, bool bBlueprintImplementable,
+	              const UClass* ImplementingClass = nullptr);
+
+	int32 GetNumClasses() const { return Requests.Num(); }
+
+	FEasyEIStubPlan Plan() const;
+
+private:
+	struct FClassRequest
+	{
+		UClass* OwnerClass = nullptr;
+		TArray<FName> HandlerNames;
+		bool bBlueprintImplementable = false;
+	};
+
+	TArray<FClassRequest> Requests;
+};
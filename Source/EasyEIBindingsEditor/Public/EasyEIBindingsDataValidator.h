@@ -0,0 +1,21 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "EditorValidatorBase.h"
+#include "EasyEIBindingsDataValidator.generated.h"
+
+/**
+ * Warns about enabled binding events whose handler the owner class does not implement,
+ * for Blueprints and levels checked by Data Validation.
+ */
+UCLASS()
+class UEasyEIBindingsDataValidator : public UEditorValidatorBase
+{
+	GENERATED_BODY()
+
+protected:
+	virtual bool CanValidateAsset_Implementation(UObject* InAsset) const override;
+	virtual EDataValidationResult ValidateLoadedAsset_Implementation(UObject* InAsset, TArray<FText>& ValidationErrors) override;
+};
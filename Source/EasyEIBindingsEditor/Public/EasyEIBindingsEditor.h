@@ -3,9 +3,25 @@
 #include "CoreMinimal.h"
 #include "Modules/ModuleManager.h"
 
+class FExtender;
+class FMenuBuilder;
+struct FAssetData;
+
 class FEasyEIBindingsEditorModule : public IModuleInterface
 {
 public:
     virtual void StartupModule() override;
     virtual void ShutdownModule() override;
+
+private:
+    void HandlePostEngineInit();
+    void HandleBlueprintCompiled();
+
+    TSharedRef<FExtender> ExtendAssetContextMenu(const TArray<FAssetData>& SelectedAssets);
+    void AddBlueprintMenuEntries(FMenuBuilder& MenuBuilder, TArray<FAssetData> SelectedBlueprints);
+    void GenerateEventsForBlueprints(TArray<FAssetData> SelectedBlueprints);
+
+    FDelegateHandle BlueprintCompiledHandle;
+    FDelegateHandle AssetContextMenuHandle;
+    FDelegateHandle ExtraObjectTagsHandle;
 };
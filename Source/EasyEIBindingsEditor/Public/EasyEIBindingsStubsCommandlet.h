@@ -0,0 +1,33 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "EasyEIBindingsCppStubs.h"
+#include "EasyEIBindingsStubsCommandlet.generated.h"
+
+/**
+ * Generates missing C++ handler stubs for every native class whose default object owns an EasyEIBindingsComponent.
+ *
+ * UnrealEditor-Cmd <Project> -run=EasyEIBindingsStubs [-BlueprintImplementable] [-DryRun] [-Diff=<File>]
+ *     [-IncludeBlueprints [-Paths=/Game+/MyPlugin]]
+ *
+ * -DryRun writes nothing, logs a unified diff of the pending changes and returns 1 when any are pending.
+ * -Diff also saves that diff to a file.
+ * -IncludeBlueprints also adds the handlers of Blueprint subclasses found under Paths to their first native parent,
+ * skipping handlers the Blueprint already implements.
+ */
+UCLASS()
+class UEasyEIBindingsStubsCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UEasyEIBindingsStubsCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+
+private:
+	int32 WritePlan(const FEasyEICppStubGenerator& Generator, int32 NumBlueprints, bool bDryRun, const FString& DiffPath);
+};
@@ -0,0 +1,29 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Commandlets/Commandlet.h"
+#include "EasyEIBindingsValidateCommandlet.generated.h"
+
+/**
+ * Reports missing handlers for every Blueprint, level and actor with Easy EI bindings, from asset registry
+ * tags alone. Tagged assets are not loaded, results are cached between runs.
+ *
+ * Tags are written when an asset is saved. Blueprints saved before the plugin was enabled are loaded instead,
+ * unless -TaggedOnly is passed; levels and external actors are only checked once resaved.
+ *
+ * UnrealEditor-Cmd <Project> -run=EasyEIBindingsValidate [-Paths=/Game+/MyPlugin] [-Cache=<File>] [-NoCache] [-TaggedOnly]
+ *
+ * Returns 1 when any handler is missing.
+ */
+UCLASS()
+class UEasyEIBindingsValidateCommandlet : public UCommandlet
+{
+	GENERATED_BODY()
+
+public:
+	UEasyEIBindingsValidateCommandlet();
+
+	virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,71 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AssetRegistry/AssetData.h"
+#include "UObject/Object.h"
+
+class IAssetRegistry;
+
+/**
+ * Handlers missing from one asset.
+ */
+struct FEasyEIValidationResult
+{
+	FAssetData Asset;
+
+	// "OwnerClass::Handler" of every enabled event without an implementation
+	TArray<FString> MissingHandlers;
+
+	// Owner classes that could not be found, so their bindings were not checked
+	TArray<FString> UnknownClasses;
+
+	bool bFromCache = false;
+};
+
+/**
+ * Checks EasyEIBindings asset registry tags against the handlers of their owner classes without loading
+ * the assets. Native classes are checked through reflection, unloaded Blueprint classes through their
+ * EasyEIHandlers tag. Results are cached per asset by a hash of its tags and of its owner classes' handlers,
+ * so only assets whose bindings or owners changed are checked again.
+ */
+class FEasyEIBindingValidator
+{
+public:
+	explicit FEasyEIBindingValidator(IAssetRegistry& InAssetRegistry);
+
+	/** Validates the assets in parallel. Assets without bindings are returned with no issues. */
+	TArray<FEasyEIValidationResult> Validate(TConstArrayView<FAssetData> Assets);
+
+	bool LoadCache(const FString& Filename);
+	bool SaveCache(const FString& Filename) const;
+
+	static FString GetDefaultCacheFilename();
+
+	/** Adds the EasyEIBindings and EasyEIHandlers tags of a Blueprint, level or external actor package. */
+	static void AppendAssetTags(const UObject* Object, TArray<UObject::FAssetRegistryTag>& OutTags);
+
+private:
+	struct FClassHandlers
+	{
+		TSet<FName> Handlers;
+		uint32 Hash = 0;
+		bool bFound = false;
+	};
+
+	struct FCacheEntry
+	{
+		uint32 Hash = 0;
+		TArray<FString> MissingHandlers;
+		TArray<FString> UnknownClasses;
+	};
+
+	/** Resolves on the game thread, the parallel passes only read the result. */
+	const FClassHandlers& FindOrResolveClass(const FString& ClassPath);
+
+	IAssetRegistry& AssetRegistry;
+
+	TMap<FString, FClassHandlers> ClassHandlers;
+	TMap<FName, FCacheEntry> Cache;
+};
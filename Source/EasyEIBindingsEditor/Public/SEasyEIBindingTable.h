@@ -0,0 +1,104 @@
+﻿// Copyright Stylianos Maimaris. All Rights Reserved.
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Widgets/SCompoundWidget.h"
+#include "Widgets/Views/SHeaderRow.h"
+#include "Widgets/Views/SListView.h"
+
+class IPropertyHandle;
+class UEasyEIBindingsComponent;
+
+/**
+ * Handler status of one InputBindings entry, computed from the details panel's (owner class, action path) status cache.
+ */
+struct FEasyEIBindingRowStatus
+{
+	// Bit N set when event slot N is enabled
+	uint8 EnabledEventSlots = 0;
+
+	// Bit N set when the owner implements the handler for event slot N
+	uint8 BoundEventSlots = 0;
+
+	bool bHasAction = false;
+
+	FText ToolTip;
+
+	int32 GetNumMissing() const
+	{
+		return bHasAction ? FMath::CountBits(EnabledEventSlots & ~BoundEventSlots) : 0;
+	}
+
+	/** Grey without an action or enabled events, yellow when a handler is missing, green otherwise. */
+	FLinearColor GetIndicatorColor() const
+	{
+		if (!bHasAction || EnabledEventSlots == 0)
+		{
+			return FLinearColor::Gray;
+		}
+		return GetNumMissing() > 0 ? FLinearColor::Yellow : FLinearColor::Green;
+	}
+};
+
+/** Returns the cached status of a binding, or null while it is being recomputed. */
+DECLARE_DELEGATE_RetVal_OneParam(const FEasyEIBindingRowStatus*, FOnGetEasyEIBindingRowStatus, int32 /*BindingIndex*/);
+
+/**
+ * Virtualized table of a component's InputBindings, one row per binding. Only visible rows are
+ * realized. Supports text filtering, sorting by action or status, and editing EnabledEvents
+ * of every selected row at once.
+ */
+class SEasyEIBindingTable : public SCompoundWidget
+{
+public:
+	SLATE_BEGIN_ARGS(SEasyEIBindingTable)
+		{
+		}
+
+		SLATE_EVENT(FOnGetEasyEIBindingRowStatus, OnGetRowStatus)
+	SLATE_END_ARGS()
+
+	struct FItem
+	{
+		int32 BindingIndex = INDEX_NONE;
+		FString ActionName;
+	};
+
+	using FItemPtr = TSharedPtr<FItem>;
+
+	void Construct(const FArguments& InArgs, UEasyEIBindingsComponent* InComponent, TSharedRef<IPropertyHandle> InBindingsHandle);
+
+	/** Rebuilds the rows from the component's InputBindings and reapplies the filter and sort. */
+	void RefreshItems();
+
+	const FEasyEIBindingRowStatus* FindRowStatus(int32 BindingIndex) const;
+
+	ECheckBoxState GetEventState(FItemPtr Item, int32 EventIndex) const;
+
+	/** Applies the change to every selected row when the edited row is selected, otherwise to the row alone. */
+	void SetEventState(ECheckBoxState NewState, FItemPtr Item, int32 EventIndex);
+
+private:
+	TSharedRef<ITableRow> GenerateRow(FItemPtr Item, const TSharedRef<STableViewBase>& OwnerTable);
+
+	void OnFilterTextChanged(const FText& InFilterText);
+	void OnSortModeChanged(EColumnSortPriority::Type SortPriority, const FName& ColumnId, EColumnSortMode::Type InSortMode);
+	EColumnSortMode::Type GetSortMode(FName ColumnId) const;
+
+	void ApplyFilterAndSort();
+
+	FText GetCountText() const;
+
+	TWeakObjectPtr<UEasyEIBindingsComponent> Component;
+	TSharedPtr<IPropertyHandle> BindingsHandle;
+	FOnGetEasyEIBindingRowStatus OnGetRowStatus;
+
+	TArray<FItemPtr> AllItems;
+	TArray<FItemPtr> FilteredItems;
+	TSharedPtr<SListView<FItemPtr>> ListView;
+
+	FString FilterText;
+	FName SortColumn;
+	EColumnSortMode::Type SortMode = EColumnSortMode::None;
+};